@@ -0,0 +1,166 @@
+
+/// @file AlgBitPlane.cc
+/// @brief AlgBitPlane の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/AlgBitPlane.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+BEGIN_NONAMESPACE
+
+// プレーン中の 1 の数を数える．
+inline
+SizeType
+_count(
+  const ymuint64* plane,
+  SizeType n
+)
+{
+  SizeType ans = 0;
+  for ( SizeType i = 0; i < n; ++ i ) {
+    ans += __builtin_popcountll(plane[i]);
+  }
+  return ans;
+}
+
+END_NONAMESPACE
+
+//////////////////////////////////////////////////////////////////////
+// クラス AlgBitPlane
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+AlgBitPlane::AlgBitPlane(
+  const AlgCover& cover
+) : mMgr{&cover.mgr()},
+    mCubeNum{cover.cube_num()},
+    mPlaneSize{AlgMgr::plane_size(mCubeNum)},
+    mPlanes(mMgr->variable_num() * 2 * mPlaneSize)
+{
+  mMgr->to_bitplane(mPlanes.data(), mCubeNum, cover.mBody);
+}
+
+// @brief リテラル数を返す．
+SizeType
+AlgBitPlane::literal_num() const
+{
+  return _count(mPlanes.data(), mPlanes.size());
+}
+
+// @brief 指定されたリテラルの出現回数を返す．
+SizeType
+AlgBitPlane::literal_num(
+  AlgLiteral lit
+) const
+{
+  return _count(plane(lit), mPlaneSize);
+}
+
+// @brief 指定されたリテラルを含むキューブ番号のリストを返す．
+vector<SizeType>
+AlgBitPlane::cube_list(
+  AlgLiteral lit
+) const
+{
+  const ymuint64* p = plane(lit);
+  vector<SizeType> ans;
+  ans.reserve(_count(p, mPlaneSize));
+  for ( SizeType w = 0; w < mPlaneSize; ++ w ) {
+    for ( ymuint64 bits = p[w]; bits != 0ULL; bits &= bits - 1 ) {
+      ans.push_back(w * 64 + __builtin_ctzll(bits));
+    }
+  }
+  return ans;
+}
+
+// @brief すべてのキューブに共通なキューブを返す．
+AlgCube
+AlgBitPlane::common_cube() const
+{
+  vector<AlgLiteral> lit_list;
+  if ( mCubeNum > 0 ) {
+    // 最後のワードは有効なビットだけを見る．
+    SizeType nw = mCubeNum / 64;
+    SizeType nr = mCubeNum % 64;
+    ymuint64 last_mask = (1ULL << nr) - 1;
+    SizeType nl = variable_num() * 2;
+    for ( SizeType i = 0; i < nl; ++ i ) {
+      const ymuint64* p = &mPlanes[i * mPlaneSize];
+      bool all = true;
+      for ( SizeType w = 0; w < nw; ++ w ) {
+	if ( p[w] != ~0ULL ) {
+	  all = false;
+	  break;
+	}
+      }
+      if ( all && nr > 0 && (p[nw] & last_mask) != last_mask ) {
+	all = false;
+      }
+      if ( all ) {
+	lit_list.push_back(AlgLiteral(i / 2, (i & 1) == 1));
+      }
+    }
+  }
+  return AlgCube(*mMgr, lit_list);
+}
+
+// @brief リテラルによる商を計算する．
+AlgCover
+AlgBitPlane::operator/(
+  AlgLiteral lit
+) const
+{
+  const ymuint64* lp = plane(lit);
+
+  // 商の中でのキューブ番号を求めるために
+  // 各ワードの手前までの lit の出現回数を求めておく．
+  vector<SizeType> base(mPlaneSize);
+  SizeType nc = 0;
+  for ( SizeType w = 0; w < mPlaneSize; ++ w ) {
+    base[w] = nc;
+    nc += __builtin_popcountll(lp[w]);
+  }
+
+  AlgCover ans{*mMgr, 0, 0, nullptr};
+  ans.resize(nc);
+  ans.mCubeNum = nc;
+  // lit を取り除いても残りのキューブの順序は変わらないので
+  // 整列し直す必要はない．
+  SizeType nl = variable_num() * 2;
+  for ( SizeType i = 0; i < nl; ++ i ) {
+    if ( i == lit.index() ) {
+      continue;
+    }
+    const ymuint64* p = &mPlanes[i * mPlaneSize];
+    SizeType var_id = i / 2;
+    AlgPol pol = (i & 1) == 0 ? kAlgPolP : kAlgPolN;
+    for ( SizeType w = 0; w < mPlaneSize; ++ w ) {
+      for ( ymuint64 bits = p[w] & lp[w]; bits != 0ULL; bits &= bits - 1 ) {
+	ymuint64 below = (bits & -bits) - 1;
+	SizeType pos = base[w] + __builtin_popcountll(lp[w] & below);
+	mMgr->set_literal(ans.mBody, pos, var_id, pol);
+      }
+    }
+  }
+
+  return ans;
+}
+
+// @brief AlgCover に戻す．
+AlgCover
+AlgBitPlane::to_cover() const
+{
+  AlgCover ans{*mMgr, 0, 0, nullptr};
+  ans.resize(mCubeNum);
+  ans.mCubeNum = mCubeNum;
+  mMgr->from_bitplane(ans.mBody, mCubeNum, mPlanes.data());
+  return ans;
+}
+
+END_NAMESPACE_YM_BFO
@@ -0,0 +1,145 @@
+
+/// @file AlgBodyAlloc.cc
+/// @brief AlgBodyAlloc の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "AlgBodyAlloc.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+BEGIN_NONAMESPACE
+
+// チャンクのワード数(64KB)
+const SizeType kChunkSize = 8 * 1024;
+
+// チャンクから切り出すブロックの最大ワード数
+// これより大きいブロックは個別に確保する．
+const SizeType kMaxSlabBlock = kChunkSize / 8;
+
+END_NONAMESPACE
+
+//////////////////////////////////////////////////////////////////////
+// クラス AlgBodyAlloc
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+AlgBodyAlloc::AlgBodyAlloc(
+  SizeType cube_size
+) : mCubeSize{cube_size > 0 ? cube_size : 1}
+{
+}
+
+// @brief デストラクタ
+AlgBodyAlloc::~AlgBodyAlloc()
+{
+  for ( auto p: mChunkList ) {
+    delete [] p;
+  }
+}
+
+// @brief 領域を確保する．
+ymuint64*
+AlgBodyAlloc::get(
+  SizeType cube_num
+)
+{
+  SizeType id = _class_id(cube_num);
+  SizeType size = _block_size(id);
+  ymuint64* p = nullptr;
+  {
+    std::lock_guard<std::mutex> lock{mMutex};
+    if ( id < mFreeList.size() && mFreeList[id] != nullptr ) {
+      // フリーリストから取り出す．
+      p = mFreeList[id];
+      mFreeList[id] = reinterpret_cast<ymuint64*>(p[0]);
+      ++ mStats.reuse_num;
+    }
+    else {
+      p = _new_block(size);
+    }
+
+    ++ mStats.alloc_num;
+    mStats.used_words += size;
+    if ( mStats.peak_words < mStats.used_words ) {
+      mStats.peak_words = mStats.used_words;
+    }
+  }
+
+  // 初期化はロックの外で行う．
+  for ( SizeType i = 0; i < size; ++ i ) {
+    p[i] = 0ULL;
+  }
+  return p;
+}
+
+// @brief 領域を返す．
+void
+AlgBodyAlloc::put(
+  ymuint64* p,
+  SizeType cube_num
+)
+{
+  if ( p == nullptr ) {
+    return;
+  }
+
+  SizeType id = _class_id(cube_num);
+  std::lock_guard<std::mutex> lock{mMutex};
+  if ( mFreeList.size() <= id ) {
+    mFreeList.resize(id + 1, nullptr);
+  }
+  p[0] = reinterpret_cast<ymuint64>(mFreeList[id]);
+  mFreeList[id] = p;
+
+  ++ mStats.free_num;
+  mStats.used_words -= _block_size(id);
+}
+
+// @brief キューブ数からサイズクラスを求める．
+SizeType
+AlgBodyAlloc::_class_id(
+  SizeType cube_num
+)
+{
+  SizeType id = 0;
+  while ( (SizeType{1} << id) < cube_num ) {
+    ++ id;
+  }
+  return id;
+}
+
+// @brief 新しいブロックを切り出す．
+ymuint64*
+AlgBodyAlloc::_new_block(
+  SizeType size
+)
+{
+  if ( size > kMaxSlabBlock ) {
+    // 大きなブロックは個別に確保する．
+    auto p = new ymuint64[size];
+    mChunkList.push_back(p);
+    ++ mStats.chunk_num;
+    mStats.reserved_words += size;
+    return p;
+  }
+
+  if ( mChunkRest < size ) {
+    // 残りは捨てて新しいチャンクを確保する．
+    mChunkPtr = new ymuint64[kChunkSize];
+    mChunkRest = kChunkSize;
+    mChunkList.push_back(mChunkPtr);
+    ++ mStats.chunk_num;
+    mStats.reserved_words += kChunkSize;
+  }
+  auto p = mChunkPtr;
+  mChunkPtr += size;
+  mChunkRest -= size;
+  return p;
+}
+
+END_NAMESPACE_YM_BFO
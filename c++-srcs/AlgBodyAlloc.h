@@ -0,0 +1,135 @@
+#ifndef ALGBODYALLOC_H
+#define ALGBODYALLOC_H
+
+/// @file AlgBodyAlloc.h
+/// @brief AlgBodyAlloc のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/bfo_nsdef.h"
+#include "ym/AlgMgr.h"
+#include <mutex>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgBodyAlloc AlgBodyAlloc.h "AlgBodyAlloc.h"
+/// @brief AlgMgr::new_body()/delete_body() のためのメモリアロケータ
+///
+/// キューブ数を 1, 2, 4, ... と2のべき乗に切り上げたものを
+/// サイズクラスとして，サイズクラスごとにフリーリストを持つ．<br>
+/// 小さなブロックは大きなチャンクから切り出して用いる．<br>
+/// 確保した領域はデストラクタでまとめて解放される．<br>
+/// get()/put()/stats() は内部で排他制御を行うので複数のスレッドから
+/// 同時に呼んでもよい．
+//////////////////////////////////////////////////////////////////////
+class AlgBodyAlloc
+{
+public:
+
+  /// @brief コンストラクタ
+  AlgBodyAlloc(
+    SizeType cube_size ///< [in] 1キューブ分のワード数
+  );
+
+  /// @brief デストラクタ
+  ///
+  /// 確保したすべての領域を解放する．
+  ~AlgBodyAlloc();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 領域を確保する．
+  ///
+  /// 内容は 0 に初期化されている．
+  ymuint64*
+  get(
+    SizeType cube_num ///< [in] キューブ数
+  );
+
+  /// @brief 領域を返す．
+  ///
+  /// cube_num は get() の時と同じ値でなければならない．
+  void
+  put(
+    ymuint64* p,      ///< [in] 領域を指すポインタ
+    SizeType cube_num ///< [in] キューブ数
+  );
+
+  /// @brief 統計情報を返す．
+  AlgAllocStats
+  stats() const
+  {
+    std::lock_guard<std::mutex> lock{mMutex};
+    return mStats;
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief キューブ数からサイズクラスを求める．
+  static
+  SizeType
+  _class_id(
+    SizeType cube_num ///< [in] キューブ数
+  );
+
+  /// @brief サイズクラスのブロックサイズ(ワード数)を返す．
+  SizeType
+  _block_size(
+    SizeType class_id ///< [in] サイズクラス
+  ) const
+  {
+    return mCubeSize << class_id;
+  }
+
+  /// @brief 新しいブロックを切り出す．
+  ymuint64*
+  _new_block(
+    SizeType size ///< [in] ブロックサイズ(ワード数)
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 1キューブ分のワード数
+  // ただし最低でも 1 とする．
+  SizeType mCubeSize;
+
+  // 以下のメンバを保護するミューテックス
+  mutable std::mutex mMutex;
+
+  // サイズクラスごとのフリーリストの先頭
+  // 空きブロックの先頭のワードを次のブロックへのポインタとして使う．
+  vector<ymuint64*> mFreeList;
+
+  // 現在切り出し中のチャンクの未使用部分の先頭
+  ymuint64* mChunkPtr{nullptr};
+
+  // 現在切り出し中のチャンクの未使用部分のワード数
+  SizeType mChunkRest{0};
+
+  // 確保したチャンクのリスト
+  vector<ymuint64*> mChunkList;
+
+  // 統計情報
+  AlgAllocStats mStats;
+
+};
+
+END_NAMESPACE_YM_BFO
+
+#endif // ALGBODYALLOC_H
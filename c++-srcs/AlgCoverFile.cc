@@ -0,0 +1,301 @@
+
+/// @file AlgCoverFile.cc
+/// @brief AlgCoverFile の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/AlgCoverFile.h"
+#include <fstream>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+BEGIN_NONAMESPACE
+
+// ファイルの先頭のマジック
+const char kMagic[8] = { 'Y', 'M', 'B', 'F', 'O', 'C', 'V', 'R' };
+
+// フォーマットのバージョン
+const ymuint64 kVersion = 1;
+
+// エンディアン検査用の値
+const ymuint64 kEndianCheck = 0x0102030405060708ULL;
+
+// ヘッダのワード位置
+enum {
+  kHeaderMagic,
+  kHeaderVersion,
+  kHeaderEndian,
+  kHeaderVarNum,
+  kHeaderCoverNum,
+  kHeaderNameSize,
+  kHeaderChecksum,
+  kHeaderSize
+};
+
+// カバーの表の1エントリのワード数
+// キューブ数，フラグ，本体の先頭位置(本体の領域の先頭からのワード数)
+const SizeType kEntrySize = 3;
+
+// 整列済みを表すフラグ
+const ymuint64 kSortedFlag = 1ULL;
+
+// チェックサムを更新する．
+ymuint64
+_checksum(
+  ymuint64 seed,
+  const ymuint64* bv,
+  SizeType n
+)
+{
+  ymuint64 ans = seed;
+  for ( SizeType i = 0; i < n; ++ i ) {
+    ans ^= bv[i];
+    ans *= 0xBF58476D1CE4E5B9ULL;
+    ans ^= ans >> 31;
+  }
+  return ans;
+}
+
+// ワード列を書き出す．
+void
+_write(
+  std::ofstream& s,
+  const ymuint64* bv,
+  SizeType n
+)
+{
+  s.write(reinterpret_cast<const char*>(bv), n * sizeof(ymuint64));
+}
+
+END_NONAMESPACE
+
+//////////////////////////////////////////////////////////////////////
+// クラス AlgCoverFile
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+AlgCoverFile::AlgCoverFile()
+{
+}
+
+// @brief デストラクタ
+AlgCoverFile::~AlgCoverFile()
+{
+  close();
+}
+
+// @brief カバーのリストをファイルに書き出す．
+bool
+AlgCoverFile::write(
+  const string& filename,
+  const vector<AlgCover>& cover_list
+)
+{
+  ASSERT_COND( !cover_list.empty() );
+
+  auto& mgr = cover_list.front().mgr();
+  SizeType nb = mgr.cube_size();
+
+  // 変数名の領域
+  string names;
+  for ( SizeType var = 0; var < mgr.variable_num(); ++ var ) {
+    names += mgr.varname(var);
+    names += '\0';
+  }
+  SizeType name_size = (names.size() + sizeof(ymuint64) - 1) / sizeof(ymuint64);
+  vector<ymuint64> name_area(name_size, 0ULL);
+  memcpy(name_area.data(), names.data(), names.size());
+
+  // カバーの表
+  SizeType nc = cover_list.size();
+  vector<ymuint64> table(nc * kEntrySize);
+  SizeType offset = 0;
+  for ( SizeType i = 0; i < nc; ++ i ) {
+    auto& cover = cover_list[i];
+    ASSERT_COND( &cover.mgr() == &mgr );
+    table[i * kEntrySize + 0] = cover.cube_num();
+    table[i * kEntrySize + 1] = kSortedFlag;
+    table[i * kEntrySize + 2] = offset;
+    offset += cover.cube_num() * nb;
+  }
+
+  // チェックサムはヘッダ以降のすべてのワードに対して計算する．
+  ymuint64 checksum = _checksum(0ULL, name_area.data(), name_size);
+  checksum = _checksum(checksum, table.data(), table.size());
+  for ( auto& cover: cover_list ) {
+    AlgCoverView view{cover};
+    checksum = _checksum(checksum, view.body(), cover.cube_num() * nb);
+  }
+
+  ymuint64 header[kHeaderSize];
+  memcpy(&header[kHeaderMagic], kMagic, sizeof(ymuint64));
+  header[kHeaderVersion] = kVersion;
+  header[kHeaderEndian] = kEndianCheck;
+  header[kHeaderVarNum] = mgr.variable_num();
+  header[kHeaderCoverNum] = nc;
+  header[kHeaderNameSize] = name_size;
+  header[kHeaderChecksum] = checksum;
+
+  std::ofstream s{filename, std::ios::binary};
+  if ( !s ) {
+    return false;
+  }
+  _write(s, header, kHeaderSize);
+  _write(s, name_area.data(), name_size);
+  _write(s, table.data(), table.size());
+  for ( auto& cover: cover_list ) {
+    AlgCoverView view{cover};
+    _write(s, view.body(), cover.cube_num() * nb);
+  }
+  return static_cast<bool>(s);
+}
+
+// @brief ファイルを開く．
+bool
+AlgCoverFile::open(
+  const string& filename
+)
+{
+  close();
+  mErrorMessage = string{};
+
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if ( fd < 0 ) {
+    return _error(filename + ": No such file");
+  }
+  struct stat st;
+  if ( fstat(fd, &st) < 0 ) {
+    ::close(fd);
+    return _error(filename + ": fstat failed");
+  }
+  SizeType size = st.st_size;
+  if ( size < kHeaderSize * sizeof(ymuint64) ) {
+    ::close(fd);
+    return _error(filename + ": too short");
+  }
+  void* p = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // マップした後はファイル記述子は不要
+  ::close(fd);
+  if ( p == MAP_FAILED ) {
+    return _error(filename + ": mmap failed");
+  }
+  mMap = static_cast<const ymuint64*>(p);
+  mMapSize = size;
+
+  const ymuint64* header = mMap;
+  if ( memcmp(&header[kHeaderMagic], kMagic, sizeof(ymuint64)) != 0 ) {
+    return _error(filename + ": not a cover file");
+  }
+  if ( header[kHeaderVersion] != kVersion ) {
+    return _error(filename + ": unsupported version");
+  }
+  if ( header[kHeaderEndian] != kEndianCheck ) {
+    return _error(filename + ": endian mismatch");
+  }
+
+  SizeType word_num = size / sizeof(ymuint64);
+  SizeType var_num = header[kHeaderVarNum];
+  SizeType name_size = header[kHeaderNameSize];
+  mCoverNum = header[kHeaderCoverNum];
+  // 変数名は少なくとも終端の '\0' の1バイトを使う．
+  if ( name_size > word_num - kHeaderSize ||
+       var_num > name_size * sizeof(ymuint64) ||
+       mCoverNum > (word_num - kHeaderSize - name_size) / kEntrySize ) {
+    return _error(filename + ": broken header");
+  }
+
+  // 変数名を取り出す．
+  const char* name_top = reinterpret_cast<const char*>(mMap + kHeaderSize);
+  const char* name_end = name_top + name_size * sizeof(ymuint64);
+  vector<string> varname_list;
+  varname_list.reserve(var_num);
+  for ( const char* s = name_top; varname_list.size() < var_num; ) {
+    const char* e = static_cast<const char*>(memchr(s, '\0', name_end - s));
+    if ( e == nullptr ) {
+      return _error(filename + ": broken variable names");
+    }
+    varname_list.push_back(string{s, e});
+    s = e + 1;
+  }
+
+  mCoverTable = mMap + kHeaderSize + name_size;
+  mBodyTop = mCoverTable + mCoverNum * kEntrySize;
+
+  // 各カバーの本体がファイルに収まっていることを確かめる．
+  mMgr.reset(new AlgMgr{varname_list});
+  SizeType nb = mMgr->cube_size();
+  SizeType body_size = word_num - (mBodyTop - mMap);
+  for ( SizeType i = 0; i < mCoverNum; ++ i ) {
+    SizeType nc = mCoverTable[i * kEntrySize + 0];
+    SizeType offset = mCoverTable[i * kEntrySize + 2];
+    if ( offset > body_size ||
+	 (nb > 0 && nc > (body_size - offset) / nb) ) {
+      return _error(filename + ": broken cover table");
+    }
+  }
+
+  return true;
+}
+
+// @brief ファイルを閉じる．
+void
+AlgCoverFile::close()
+{
+  if ( mMap != nullptr ) {
+    munmap(const_cast<ymuint64*>(mMap), mMapSize);
+  }
+  mMap = nullptr;
+  mMapSize = 0;
+  mMgr.reset();
+  mCoverNum = 0;
+  mCoverTable = nullptr;
+  mBodyTop = nullptr;
+}
+
+// @brief チェックサムを検査する．
+bool
+AlgCoverFile::verify() const
+{
+  if ( mMap == nullptr ) {
+    return false;
+  }
+  SizeType word_num = mMapSize / sizeof(ymuint64);
+  ymuint64 checksum = _checksum(0ULL, mMap + kHeaderSize,
+				word_num - kHeaderSize);
+  return checksum == mMap[kHeaderChecksum];
+}
+
+// @brief カバーを返す．
+AlgCoverView
+AlgCoverFile::cover(
+  SizeType pos
+) const
+{
+  ASSERT_COND( pos < cover_num() );
+
+  const ymuint64* entry = mCoverTable + pos * kEntrySize;
+  bool sorted = (entry[1] & kSortedFlag) != 0ULL;
+  return AlgCoverView{*mMgr, entry[0], mBodyTop + entry[2], sorted};
+}
+
+// @brief エラーメッセージをセットしてファイルを閉じる．
+bool
+AlgCoverFile::_error(
+  const string& msg
+)
+{
+  close();
+  mErrorMessage = msg;
+  return false;
+}
+
+END_NAMESPACE_YM_BFO
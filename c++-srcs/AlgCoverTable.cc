@@ -0,0 +1,102 @@
+
+/// @file AlgCoverTable.cc
+/// @brief AlgCoverTable の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/AlgCoverTable.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+// クラス AlgCoverTable
+//////////////////////////////////////////////////////////////////////
+
+// @brief カバーを登録して共有されたものを返す．
+std::shared_ptr<const AlgCover>
+AlgCoverTable::intern(
+  const AlgCover& cover
+)
+{
+  ASSERT_COND( &cover.mgr() == &mMgr );
+
+  SizeType h = cover.hash();
+  auto ans = _find(h, cover);
+  if ( ans == nullptr ) {
+    ans = std::make_shared<const AlgCover>(cover);
+    mTable.emplace(h, ans);
+  }
+  return ans;
+}
+
+// @brief カバーを登録して共有されたものを返す．
+std::shared_ptr<const AlgCover>
+AlgCoverTable::intern(
+  AlgCover&& cover
+)
+{
+  ASSERT_COND( &cover.mgr() == &mMgr );
+
+  SizeType h = cover.hash();
+  auto ans = _find(h, cover);
+  if ( ans == nullptr ) {
+    ans = std::make_shared<const AlgCover>(std::move(cover));
+    mTable.emplace(h, ans);
+  }
+  return ans;
+}
+
+// @brief 参照の残っている登録済みのカバー数を返す．
+SizeType
+AlgCoverTable::size() const
+{
+  SizeType n = 0;
+  for ( auto& p: mTable ) {
+    if ( !p.second.expired() ) {
+      ++ n;
+    }
+  }
+  return n;
+}
+
+// @brief 参照のなくなったエントリを取り除く．
+void
+AlgCoverTable::purge()
+{
+  for ( auto p = mTable.begin(); p != mTable.end(); ) {
+    if ( p->second.expired() ) {
+      p = mTable.erase(p);
+    }
+    else {
+      ++ p;
+    }
+  }
+}
+
+// @brief 登録済みのカバーを探す．
+std::shared_ptr<const AlgCover>
+AlgCoverTable::_find(
+  SizeType h,
+  const AlgCover& cover
+)
+{
+  auto range = mTable.equal_range(h);
+  for ( auto p = range.first; p != range.second; ) {
+    auto cover1 = p->second.lock();
+    if ( cover1 == nullptr ) {
+      p = mTable.erase(p);
+      continue;
+    }
+    if ( *cover1 == cover ) {
+      return cover1;
+    }
+    ++ p;
+  }
+  return nullptr;
+}
+
+END_NAMESPACE_YM_BFO
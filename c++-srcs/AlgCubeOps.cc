@@ -0,0 +1,248 @@
+
+/// @file AlgCubeOps.cc
+/// @brief AlgCubeOps の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "AlgCubeOps.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+BEGIN_NONAMESPACE
+
+// 偶数ビット(負極性のビット)のマスク
+const ymuint64 kMask55 = 0x5555555555555555ULL;
+
+// 奇数ビット(正極性のビット)のマスク
+const ymuint64 kMaskAA = 0xAAAAAAAAAAAAAAAAULL;
+
+// 同じ変数の異なる極性のリテラルがあったら true を返す．
+inline
+bool
+_conflict(
+  ymuint64 pat
+)
+{
+  return ((pat & kMask55) & ((pat & kMaskAA) >> 1)) != 0ULL;
+}
+
+// キューブ演算の本体
+//
+// N はキューブのワード数で，0 の時は実行時の nb を用いる．
+// N が定数の時はループの回数がコンパイル時に決まるので
+// コンパイラが展開できる．
+template<SizeType N>
+struct CubeKernel
+{
+  static
+  SizeType
+  words(
+    SizeType nb
+  )
+  {
+    return N == 0 ? nb : N;
+  }
+
+  static
+  int
+  compare(
+    const ymuint64* bv1,
+    const ymuint64* bv2,
+    SizeType nb
+  )
+  {
+    SizeType n = words(nb);
+    for ( SizeType i = 0; i < n; ++ i ) {
+      ymuint64 pat1 = bv1[i];
+      ymuint64 pat2 = bv2[i];
+      if ( pat1 < pat2 ) {
+	return -1;
+      }
+      else if ( pat1 > pat2 ) {
+	return 1;
+      }
+    }
+    return 0;
+  }
+
+  static
+  bool
+  check_product(
+    const ymuint64* bv1,
+    const ymuint64* bv2,
+    SizeType nb
+  )
+  {
+    SizeType n = words(nb);
+    // 分岐を減らすために全ワードの結果を OR でまとめる．
+    ymuint64 bad = 0ULL;
+    for ( SizeType i = 0; i < n; ++ i ) {
+      ymuint64 tmp = bv1[i] | bv2[i];
+      bad |= (tmp & kMask55) & ((tmp & kMaskAA) >> 1);
+    }
+    return bad == 0ULL;
+  }
+
+  static
+  bool
+  check_containment(
+    const ymuint64* bv1,
+    const ymuint64* bv2,
+    SizeType nb
+  )
+  {
+    SizeType n = words(nb);
+    ymuint64 diff = 0ULL;
+    for ( SizeType i = 0; i < n; ++ i ) {
+      diff |= ~bv1[i] & bv2[i];
+    }
+    return diff == 0ULL;
+  }
+
+  static
+  bool
+  check_intersect(
+    const ymuint64* bv1,
+    const ymuint64* bv2,
+    SizeType nb
+  )
+  {
+    SizeType n = words(nb);
+    ymuint64 common = 0ULL;
+    for ( SizeType i = 0; i < n; ++ i ) {
+      common |= bv1[i] & bv2[i];
+    }
+    return common != 0ULL;
+  }
+
+  static
+  bool
+  product(
+    ymuint64* dst,
+    const ymuint64* bv1,
+    const ymuint64* bv2,
+    SizeType nb
+  )
+  {
+    SizeType n = words(nb);
+    if ( N == 0 ) {
+      // ワード数が大きい場合は早めに打ち切る．
+      for ( SizeType i = 0; i < n; ++ i ) {
+	ymuint64 tmp = bv1[i] | bv2[i];
+	if ( _conflict(tmp) ) {
+	  // この場合の dst の値は不定
+	  return false;
+	}
+	dst[i] = tmp;
+      }
+      return true;
+    }
+    ymuint64 bad = 0ULL;
+    for ( SizeType i = 0; i < n; ++ i ) {
+      ymuint64 tmp = bv1[i] | bv2[i];
+      bad |= (tmp & kMask55) & ((tmp & kMaskAA) >> 1);
+      dst[i] = tmp;
+    }
+    return bad == 0ULL;
+  }
+
+  static
+  bool
+  division(
+    ymuint64* dst,
+    const ymuint64* bv1,
+    const ymuint64* bv2,
+    SizeType nb
+  )
+  {
+    SizeType n = words(nb);
+    if ( N == 0 ) {
+      for ( SizeType i = 0; i < n; ++ i ) {
+	if ( (~bv1[i] & bv2[i]) != 0ULL ) {
+	  // この場合の dst の値は不定
+	  return false;
+	}
+	dst[i] = bv1[i] & ~bv2[i];
+      }
+      return true;
+    }
+    ymuint64 diff = 0ULL;
+    for ( SizeType i = 0; i < n; ++ i ) {
+      diff |= ~bv1[i] & bv2[i];
+      dst[i] = bv1[i] & ~bv2[i];
+    }
+    return diff == 0ULL;
+  }
+
+  static
+  void
+  copy(
+    ymuint64* dst,
+    const ymuint64* src,
+    SizeType cube_num,
+    SizeType nb
+  )
+  {
+    SizeType n = words(nb);
+    for ( SizeType c = 0; c < cube_num; ++ c, dst += n, src += n ) {
+      for ( SizeType i = 0; i < n; ++ i ) {
+	dst[i] = src[i];
+      }
+    }
+  }
+
+  static
+  void
+  clear(
+    ymuint64* dst,
+    SizeType nb
+  )
+  {
+    SizeType n = words(nb);
+    for ( SizeType i = 0; i < n; ++ i ) {
+      dst[i] = 0ULL;
+    }
+  }
+
+  // 関数の表
+  static const AlgCubeOps sOps;
+};
+
+template<SizeType N>
+const AlgCubeOps CubeKernel<N>::sOps = {
+  &CubeKernel<N>::compare,
+  &CubeKernel<N>::check_product,
+  &CubeKernel<N>::check_containment,
+  &CubeKernel<N>::check_intersect,
+  &CubeKernel<N>::product,
+  &CubeKernel<N>::division,
+  &CubeKernel<N>::copy,
+  &CubeKernel<N>::clear,
+};
+
+END_NONAMESPACE
+
+//////////////////////////////////////////////////////////////////////
+// クラス AlgCubeOps
+//////////////////////////////////////////////////////////////////////
+
+// @brief ワード数に合った関数の表を返す．
+const AlgCubeOps*
+AlgCubeOps::get(
+  SizeType nb
+)
+{
+  switch ( nb ) {
+  case 1: return &CubeKernel<1>::sOps;
+  case 2: return &CubeKernel<2>::sOps;
+  case 4: return &CubeKernel<4>::sOps;
+  default: break;
+  }
+  return &CubeKernel<0>::sOps;
+}
+
+END_NAMESPACE_YM_BFO
@@ -0,0 +1,69 @@
+#ifndef ALGCUBEOPS_H
+#define ALGCUBEOPS_H
+
+/// @file AlgCubeOps.h
+/// @brief AlgCubeOps のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/bfo_nsdef.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgCubeOps AlgCubeOps.h "AlgCubeOps.h"
+/// @brief キューブ単位の演算を行う関数の表
+///
+/// キューブのワード数が 1, 2, 4 の場合はワード数をテンプレート引数
+/// として特殊化したものを，それ以外の場合は実行時にワード数を
+/// 受け取るものを用いる．<br>
+/// AlgMgr は構築時に get() で自分のワード数に合ったものを選んでおく．<br>
+/// どの関数もキューブの先頭を指すポインタを受け取り，nb はキューブの
+/// ワード数を表す(特殊化したものでは無視される)．
+//////////////////////////////////////////////////////////////////////
+struct AlgCubeOps
+{
+  /// @brief キューブの比較を行う．
+  /// @retval -1 bv1 <  bv2
+  /// @retval  0 bv1 == bv2
+  /// @retval  1 bv1 >  bv2
+  int (*compare)(const ymuint64* bv1, const ymuint64* bv2, SizeType nb);
+
+  /// @brief 2つのキューブの積が空でない時 true を返す．
+  bool (*check_product)(const ymuint64* bv1, const ymuint64* bv2, SizeType nb);
+
+  /// @brief bv1 が bv2 に含まれていたら true を返す．
+  bool (*check_containment)(const ymuint64* bv1, const ymuint64* bv2, SizeType nb);
+
+  /// @brief 2つのキューブに共通なリテラルがあれば true を返す．
+  bool (*check_intersect)(const ymuint64* bv1, const ymuint64* bv2, SizeType nb);
+
+  /// @brief 2つのキューブの積を計算する．
+  /// @return 積が空の時 false を返す．
+  bool (*product)(ymuint64* dst, const ymuint64* bv1, const ymuint64* bv2, SizeType nb);
+
+  /// @brief キューブによる商を計算する．
+  /// @return 割り切れない時 false を返す．
+  bool (*division)(ymuint64* dst, const ymuint64* bv1, const ymuint64* bv2, SizeType nb);
+
+  /// @brief cube_num 個のキューブをコピーする．
+  void (*copy)(ymuint64* dst, const ymuint64* src, SizeType cube_num, SizeType nb);
+
+  /// @brief キューブをクリアする．
+  void (*clear)(ymuint64* dst, SizeType nb);
+
+  /// @brief ワード数に合った関数の表を返す．
+  static
+  const AlgCubeOps*
+  get(
+    SizeType nb ///< [in] キューブのワード数
+  );
+
+};
+
+END_NAMESPACE_YM_BFO
+
+#endif // ALGCUBEOPS_H
@@ -0,0 +1,311 @@
+
+/// @file AlgExpr.cc
+/// @brief AlgExpr の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/AlgExpr.h"
+#include "ym/AlgCover.h"
+#include "ym/AlgMgr.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+// AlgExpr のノード
+//////////////////////////////////////////////////////////////////////
+struct AlgExpr::Node
+{
+  // 種類
+  enum Type {
+    kZero,
+    kOne,
+    kLiteral,
+    kAnd,
+    kOr
+  };
+
+  // 種類
+  Type mType;
+
+  // リテラル
+  // kLiteral の時のみ意味を持つ．
+  AlgLiteral mLiteral;
+
+  // オペランドのリスト
+  // kAnd, kOr の時のみ意味を持つ．
+  vector<AlgExpr> mOperandList;
+
+  // リテラル数
+  SizeType mLiteralNum;
+};
+
+BEGIN_NONAMESPACE
+
+// 変数名を使って出力する．
+// mgr が nullptr の時は AlgLiteral の出力形式を使う．
+void
+_print(
+  ostream& s,
+  const AlgExpr& expr,
+  const AlgMgr* mgr
+)
+{
+  if ( expr.is_zero() ) {
+    s << "0";
+  }
+  else if ( expr.is_one() ) {
+    s << "1";
+  }
+  else if ( expr.is_literal() ) {
+    auto lit = expr.literal();
+    if ( mgr != nullptr ) {
+      s << mgr->varname(lit.varid());
+      if ( lit.is_negative() ) {
+	s << "'";
+      }
+    }
+    else {
+      s << lit;
+    }
+  }
+  else if ( expr.is_and() ) {
+    const char* sep = "";
+    for ( auto& opr: expr.operand_list() ) {
+      s << sep;
+      sep = " ";
+      if ( opr.is_or() ) {
+	s << "(";
+	_print(s, opr, mgr);
+	s << ")";
+      }
+      else {
+	_print(s, opr, mgr);
+      }
+    }
+  }
+  else {
+    const char* sep = "";
+    for ( auto& opr: expr.operand_list() ) {
+      s << sep;
+      sep = " + ";
+      _print(s, opr, mgr);
+    }
+  }
+}
+
+END_NONAMESPACE
+
+//////////////////////////////////////////////////////////////////////
+// クラス AlgExpr
+//////////////////////////////////////////////////////////////////////
+
+// @brief 空のコンストラクタ
+AlgExpr::AlgExpr(
+) : AlgExpr{zero()}
+{
+}
+
+// @brief 定数0を作る．
+AlgExpr
+AlgExpr::zero()
+{
+  static const auto node = std::make_shared<const Node>(Node{Node::kZero, AlgLiteral{}, {}, 0});
+  return AlgExpr{node};
+}
+
+// @brief 定数1を作る．
+AlgExpr
+AlgExpr::one()
+{
+  static const auto node = std::make_shared<const Node>(Node{Node::kOne, AlgLiteral{}, {}, 0});
+  return AlgExpr{node};
+}
+
+// @brief リテラルを作る．
+AlgExpr
+AlgExpr::literal(
+  AlgLiteral lit
+)
+{
+  return AlgExpr{std::make_shared<const Node>(Node{Node::kLiteral, lit, {}, 1})};
+}
+
+// @brief 定数0の時 true を返す．
+bool
+AlgExpr::is_zero() const
+{
+  return mNode->mType == Node::kZero;
+}
+
+// @brief 定数1の時 true を返す．
+bool
+AlgExpr::is_one() const
+{
+  return mNode->mType == Node::kOne;
+}
+
+// @brief リテラルの時 true を返す．
+bool
+AlgExpr::is_literal() const
+{
+  return mNode->mType == Node::kLiteral;
+}
+
+// @brief AND の時 true を返す．
+bool
+AlgExpr::is_and() const
+{
+  return mNode->mType == Node::kAnd;
+}
+
+// @brief OR の時 true を返す．
+bool
+AlgExpr::is_or() const
+{
+  return mNode->mType == Node::kOr;
+}
+
+// @brief リテラルを返す．
+AlgLiteral
+AlgExpr::literal() const
+{
+  return mNode->mLiteral;
+}
+
+// @brief オペランドのリストを返す．
+const vector<AlgExpr>&
+AlgExpr::operand_list() const
+{
+  return mNode->mOperandList;
+}
+
+// @brief リテラル数を返す．
+SizeType
+AlgExpr::literal_num() const
+{
+  return mNode->mLiteralNum;
+}
+
+// @brief 積和形に展開したカバーを返す．
+AlgCover
+AlgExpr::to_cover(
+  AlgMgr& mgr
+) const
+{
+  switch ( mNode->mType ) {
+  case Node::kZero:
+    return AlgCover{mgr};
+
+  case Node::kOne:
+    return AlgCover{mgr, 0};
+
+  case Node::kLiteral:
+    return AlgCover{mgr, vector<AlgLiteral>{literal()}};
+
+  case Node::kAnd:
+    {
+      AlgCover ans{mgr, 0};
+      for ( auto& opr: operand_list() ) {
+	ans *= opr.to_cover(mgr);
+      }
+      return ans;
+    }
+
+  case Node::kOr:
+    {
+      AlgCover ans{mgr};
+      for ( auto& opr: operand_list() ) {
+	ans += opr.to_cover(mgr);
+      }
+      return ans;
+    }
+  }
+  ASSERT_NOT_REACHED;
+  return AlgCover{mgr};
+}
+
+// @brief 内容をわかりやすい形で出力する．
+void
+AlgExpr::print(
+  ostream& s,
+  const AlgMgr& mgr
+) const
+{
+  _print(s, *this, &mgr);
+}
+
+// @brief 構造が等しい時 true を返す．
+bool
+AlgExpr::operator==(
+  const AlgExpr& right
+) const
+{
+  if ( mNode == right.mNode ) {
+    return true;
+  }
+  if ( mNode->mType != right.mNode->mType ) {
+    return false;
+  }
+  if ( is_literal() ) {
+    return literal() == right.literal();
+  }
+  return operand_list() == right.operand_list();
+}
+
+// @brief AND/OR を作る．
+AlgExpr
+AlgExpr::_make_op(
+  bool is_and,
+  const vector<AlgExpr>& opr_list
+)
+{
+  // AND にとっての 0 (OR にとっての 1) は全体を支配し，
+  // AND にとっての 1 (OR にとっての 0) は無視できる．
+  auto type = is_and ? Node::kAnd : Node::kOr;
+  auto dom_type = is_and ? Node::kZero : Node::kOne;
+  auto id_type = is_and ? Node::kOne : Node::kZero;
+  Node node{type, AlgLiteral{}, {}, 0};
+  for ( auto& expr: opr_list ) {
+    auto opr_type = expr.mNode->mType;
+    if ( opr_type == dom_type ) {
+      return expr;
+    }
+    if ( opr_type == id_type ) {
+      continue;
+    }
+    if ( opr_type == type ) {
+      // 同じ種類の子供は平坦化する．
+      auto& src_list = expr.operand_list();
+      node.mOperandList.insert(node.mOperandList.end(),
+			       src_list.begin(), src_list.end());
+    }
+    else {
+      node.mOperandList.push_back(expr);
+    }
+    node.mLiteralNum += expr.literal_num();
+  }
+  if ( node.mOperandList.empty() ) {
+    return is_and ? one() : zero();
+  }
+  if ( node.mOperandList.size() == 1 ) {
+    return node.mOperandList.front();
+  }
+  return AlgExpr{std::make_shared<const Node>(std::move(node))};
+}
+
+// @brief AlgExpr の内容を出力する．
+ostream&
+operator<<(
+  ostream& s,
+  const AlgExpr& expr
+)
+{
+  _print(s, expr, nullptr);
+  return s;
+}
+
+END_NAMESPACE_YM_BFO
@@ -0,0 +1,205 @@
+
+/// @file AlgFactorGen.cc
+/// @brief AlgFactorGen の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2017, 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/AlgFactorGen.h"
+#include "ym/AlgCube.h"
+#include "ym/AlgMgr.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+// クラス AlgFactorGen
+//////////////////////////////////////////////////////////////////////
+
+// @brief ファクタリングを行う．
+AlgExpr
+AlgFactorGen::factor(
+  const AlgCover& cover
+)
+{
+  auto p = mMemo.find(cover);
+  if ( p != mMemo.end() ) {
+    return p->second;
+  }
+
+  AlgExpr ans;
+  if ( cover.cube_num() <= 1 ) {
+    ans = _sop_expr(cover);
+  }
+  else if ( mMode == kAlgFactorLiteral ) {
+    auto lit = _best_literal(cover);
+    if ( lit == AlgLiteralUndef ) {
+      ans = _sop_expr(cover);
+    }
+    else {
+      ans = _literal_factor(cover, lit);
+    }
+  }
+  else {
+    auto d = _divisor(cover);
+    if ( d.cube_num() == 0 ) {
+      ans = _sop_expr(cover);
+    }
+    else {
+      auto q = cover / d;
+      if ( q.cube_num() == 1 ) {
+	// 商が1つのキューブの場合はそのリテラルで括りだす．
+	auto cube = q.common_cube();
+	auto lit = _best_literal(cover, &cube);
+	if ( lit == AlgLiteralUndef ) {
+	  ans = _sop_expr(cover);
+	}
+	else {
+	  ans = _literal_factor(cover, lit);
+	}
+      }
+      else {
+	// 商をキューブフリーにしてから割り直す．
+	q /= q.common_cube();
+	auto dr = cover.div_rem(q);
+	auto& d1 = dr.first;
+	auto& r = dr.second;
+	auto cube = d1.common_cube();
+	if ( cube.literal_num() == 0 ) {
+	  ans = (factor(q) & factor(d1)) | factor(r);
+	}
+	else {
+	  auto lit = _best_literal(cover, &cube);
+	  ASSERT_COND( lit != AlgLiteralUndef );
+	  ans = _literal_factor(cover, lit);
+	}
+      }
+    }
+  }
+
+  mMemo.emplace(cover, ans);
+  return ans;
+}
+
+// @brief 除数を選ぶ．
+AlgCover
+AlgFactorGen::_divisor(
+  const AlgCover& cover
+)
+{
+  if ( mMode == kAlgFactorGood ) {
+    // 括りだした時に減るリテラル数が最大のカーネルを選ぶ．
+    // kernel * q を展開すると
+    //   |q| * lit(kernel) + |kernel| * lit(q)
+    // 個のリテラルが lit(kernel) + lit(q) 個になる．
+    vector<AlgKernelInfo> kernel_list;
+    mKernelGen.generate(cover, kernel_list);
+    const AlgCover* best = nullptr;
+    SizeType best_value = 0;
+    for ( auto& info: kernel_list ) {
+      auto& kernel = info.mKernel;
+      if ( kernel == cover ) {
+	continue;
+      }
+      auto q = cover / kernel;
+      if ( q.cube_num() == 0 ) {
+	continue;
+      }
+      SizeType value = (q.cube_num() - 1) * kernel.literal_num()
+	+ (kernel.cube_num() - 1) * q.literal_num();
+      if ( best_value < value ) {
+	best_value = value;
+	best = &kernel;
+      }
+    }
+    if ( best == nullptr ) {
+      return AlgCover{cover.mgr()};
+    }
+    return *best;
+  }
+
+  // 2回以上現れるリテラルで割ってキューブフリーにすることを
+  // 繰り返してレベル0カーネルを1つ求める．
+  AlgCover d{cover};
+  for ( ; ; ) {
+    auto lit = _best_literal(d);
+    if ( lit == AlgLiteralUndef ) {
+      break;
+    }
+    d /= lit;
+    d /= d.common_cube();
+  }
+  if ( d == cover ) {
+    return AlgCover{cover.mgr()};
+  }
+  return d;
+}
+
+// @brief リテラルで括りだす．
+AlgExpr
+AlgFactorGen::_literal_factor(
+  const AlgCover& cover,
+  AlgLiteral lit
+)
+{
+  auto q = cover / lit;
+  auto r = cover - q * lit;
+  return (AlgExpr::literal(lit) & factor(q)) | factor(r);
+}
+
+// @brief キューブ中で最も出現頻度の高いリテラルを選ぶ．
+AlgLiteral
+AlgFactorGen::_best_literal(
+  const AlgCover& cover,
+  const AlgCube* cube
+)
+{
+  auto hist = cover.literal_histogram();
+  AlgLiteral ans = AlgLiteralUndef;
+  SizeType max_num = 1;
+  for ( SizeType i = 0; i < hist.size(); ++ i ) {
+    if ( hist[i] <= max_num ) {
+      continue;
+    }
+    AlgLiteral lit(i / 2, (i & 1) == 1);
+    if ( cube != nullptr && !cube->has_literal(lit) ) {
+      continue;
+    }
+    max_num = hist[i];
+    ans = lit;
+  }
+  return ans;
+}
+
+// @brief カバーをそのまま積和形の論理式にする．
+AlgExpr
+AlgFactorGen::_sop_expr(
+  const AlgCover& cover
+)
+{
+  SizeType nv = cover.variable_num();
+  vector<AlgExpr> cube_list;
+  cube_list.reserve(cover.cube_num());
+  vector<AlgExpr> lit_list;
+  for ( SizeType i = 0; i < cover.cube_num(); ++ i ) {
+    lit_list.clear();
+    for ( SizeType var = 0; var < nv; ++ var ) {
+      switch ( cover.literal(i, var) ) {
+      case kAlgPolP:
+	lit_list.push_back(AlgExpr::literal(AlgLiteral(var, false)));
+	break;
+      case kAlgPolN:
+	lit_list.push_back(AlgExpr::literal(AlgLiteral(var, true)));
+	break;
+      default:
+	break;
+      }
+    }
+    cube_list.push_back(AlgExpr::and_op(lit_list));
+  }
+  return AlgExpr::or_op(cube_list);
+}
+
+END_NAMESPACE_YM_BFO
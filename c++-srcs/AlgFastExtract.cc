@@ -0,0 +1,325 @@
+
+/// @file AlgFastExtract.cc
+/// @brief AlgFastExtract の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/AlgFastExtract.h"
+#include "ym/AlgMgr.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+BEGIN_NONAMESPACE
+
+// カバーのすべてのキューブの OR を求める．
+vector<ymuint64>
+_support(
+  const ymuint64* bv,
+  SizeType cube_num,
+  SizeType cube_size
+)
+{
+  vector<ymuint64> ans(cube_size, 0ULL);
+  for ( SizeType i = 0; i < cube_num * cube_size; ++ i ) {
+    ans[i % cube_size] |= bv[i];
+  }
+  return ans;
+}
+
+END_NONAMESPACE
+
+//////////////////////////////////////////////////////////////////////
+// クラス AlgFastExtract
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+AlgFastExtract::AlgFastExtract(
+  AlgMgr& mgr
+) : mMgr{mgr},
+    mCubeSize{mgr.cube_size()}
+{
+}
+
+// @brief デストラクタ
+AlgFastExtract::~AlgFastExtract()
+{
+}
+
+// @brief 除数の括りだしを行う．
+vector<AlgFxStep>
+AlgFastExtract::extract(
+  vector<AlgCover>& cover_list,
+  SizeType max_step
+)
+{
+  SizeType nb = mCubeSize;
+
+  mDivList.clear();
+  mDivHash.clear();
+  mHeap = std::priority_queue<HeapEntry>{};
+  mDirtyList.clear();
+
+  // どのカバーにも現れない変数を新しいノード用に使う．
+  // 同時に各カバーのサポートを求めておく．
+  vector<vector<ymuint64>> sup_list;
+  vector<ymuint64> all_sup(nb, 0ULL);
+  SizeType total = 0;
+  for ( auto& cover: cover_list ) {
+    ASSERT_COND( &cover.mgr() == &mMgr );
+    sup_list.push_back(_support(cover.mBody, cover.cube_num(), nb));
+    for ( SizeType k = 0; k < nb; ++ k ) {
+      all_sup[k] |= sup_list.back()[k];
+    }
+    total += cover.literal_num();
+    _scan(cover, 1);
+  }
+  _flush();
+  vector<SizeType> free_list;
+  for ( SizeType var = 0; var < mMgr.variable_num(); ++ var ) {
+    if ( mMgr.literal(all_sup.data(), 0, var) == kAlgPolX ) {
+      free_list.push_back(var);
+    }
+  }
+
+  vector<AlgFxStep> step_list;
+  SizeType next_free = 0;
+  SizeType id;
+  while ( step_list.size() < max_step &&
+	  next_free < free_list.size() &&
+	  _pop(id) ) {
+    // mDivList は以下の処理で伸びるのでコピーしておく．
+    bool single = mDivList[id].mSingle;
+    SizeType nd = single ? 1 : 2;
+    AlgCover divisor = _make_cover(mDivList[id].mKey.data(), nd);
+    auto div_sup = _support(divisor.mBody, nd, nb);
+    SizeType var = free_list[next_free];
+    AlgLiteral lit{static_cast<int>(var), false};
+
+    // 除数を含むカバーを書き換える．
+    int delta = 0;
+    bool changed = false;
+    for ( SizeType k = 0; k < cover_list.size(); ++ k ) {
+      auto& cover = cover_list[k];
+      if ( cover.cube_num() < nd ) {
+	continue;
+      }
+      // サポートに含まれない変数を持つ除数では割り切れない．
+      bool ok = true;
+      for ( SizeType w = 0; w < nb; ++ w ) {
+	if ( (div_sup[w] & ~sup_list[k][w]) != 0ULL ) {
+	  ok = false;
+	  break;
+	}
+      }
+      if ( !ok ) {
+	continue;
+      }
+      auto qr = cover.div_rem(divisor);
+      if ( qr.first.cube_num() == 0 ) {
+	continue;
+      }
+
+      // cover = q * x + r
+      AlgCover new_cover = std::move(qr.first) * lit + qr.second;
+      _scan(cover, -1);
+      delta -= static_cast<int>(cover.literal_num());
+      cover = std::move(new_cover);
+      _scan(cover, 1);
+      delta += static_cast<int>(cover.literal_num());
+      sup_list[k] = _support(cover.mBody, cover.cube_num(), nb);
+      changed = true;
+    }
+    if ( !changed ) {
+      // 見積もりと異なり割り切れるカバーがなかった．
+      _flush();
+      continue;
+    }
+    ++ next_free;
+
+    // 除数を新しいノードとして追加する．
+    _scan(divisor, 1);
+    delta += static_cast<int>(divisor.literal_num());
+    sup_list.push_back(div_sup);
+    cover_list.push_back(divisor);
+    _flush();
+
+    total += delta;
+    step_list.push_back(AlgFxStep{var, std::move(divisor), single, -delta, total});
+  }
+
+  return step_list;
+}
+
+// @brief カバーに含まれる除数を数える．
+void
+AlgFastExtract::_scan(
+  const AlgCover& cover,
+  int sign
+)
+{
+  SizeType nb = mCubeSize;
+  SizeType nc = cover.cube_num();
+  const ymuint64* bv = cover.mBody;
+
+  // 2キューブの除数
+  // 2つのキューブ ci, cj の共通部分 b で割った {ci/b, cj/b} が除数となる．
+  vector<ymuint64> base(nb);
+  vector<ymuint64> key(nb * 2);
+  for ( SizeType i = 0; i < nc; ++ i ) {
+    const ymuint64* ci = bv + i * nb;
+    for ( SizeType j = i + 1; j < nc; ++ j ) {
+      const ymuint64* cj = bv + j * nb;
+      bool empty1 = true;
+      bool empty2 = true;
+      for ( SizeType k = 0; k < nb; ++ k ) {
+	base[k] = ci[k] & cj[k];
+	key[k] = ci[k] & ~base[k];
+	key[k + nb] = cj[k] & ~base[k];
+	if ( key[k] != 0ULL ) {
+	  empty1 = false;
+	}
+	if ( key[k + nb] != 0ULL ) {
+	  empty2 = false;
+	}
+      }
+      if ( empty1 || empty2 ) {
+	// 一方が他方を含んでいる．
+	continue;
+      }
+      // 2つのキューブを降順に並べる．
+      for ( SizeType k = 0; k < nb; ++ k ) {
+	if ( key[k] != key[k + nb] ) {
+	  if ( key[k] < key[k + nb] ) {
+	    std::swap_ranges(key.begin(), key.begin() + nb, key.begin() + nb);
+	  }
+	  break;
+	}
+      }
+      int lit_num = static_cast<int>(mMgr.literal_num(2, key.data()));
+      int base_num = static_cast<int>(mMgr.literal_num(1, base.data()));
+      _count(key, false, lit_num, base_num, sign);
+    }
+  }
+
+  // 単一キューブの除数
+  // キューブ中の2つのリテラルの組が除数となる．
+  vector<ymuint64> key1(nb);
+  vector<pair<SizeType, ymuint64>> bit_list;
+  for ( SizeType i = 0; i < nc; ++ i ) {
+    const ymuint64* ci = bv + i * nb;
+    bit_list.clear();
+    for ( SizeType k = 0; k < nb; ++ k ) {
+      for ( ymuint64 pat = ci[k]; pat != 0ULL; pat &= pat - 1 ) {
+	bit_list.push_back(make_pair(k, pat & (~pat + 1)));
+      }
+    }
+    for ( SizeType a = 0; a < bit_list.size(); ++ a ) {
+      for ( SizeType b = a + 1; b < bit_list.size(); ++ b ) {
+	for ( SizeType k = 0; k < nb; ++ k ) {
+	  key1[k] = 0ULL;
+	}
+	key1[bit_list[a].first] |= bit_list[a].second;
+	key1[bit_list[b].first] |= bit_list[b].second;
+	_count(key1, true, 2, 0, sign);
+      }
+    }
+  }
+}
+
+// @brief 除数の出現を登録する．
+void
+AlgFastExtract::_count(
+  const vector<ymuint64>& key,
+  bool single,
+  int lit_num,
+  int base_num,
+  int sign
+)
+{
+  SizeType id;
+  auto p = mDivHash.find(key);
+  if ( p != mDivHash.end() ) {
+    id = p->second;
+  }
+  else {
+    id = mDivList.size();
+    mDivHash.emplace(key, id);
+    mDivList.push_back(Divisor{key, single, lit_num});
+  }
+  auto& div = mDivList[id];
+  div.mOccNum += sign;
+  div.mBaseSum += sign * base_num;
+  if ( !div.mDirty ) {
+    div.mDirty = true;
+    mDirtyList.push_back(id);
+  }
+}
+
+// @brief 更新された除数を優先度付きキューに積む．
+void
+AlgFastExtract::_flush()
+{
+  for ( auto id: mDirtyList ) {
+    auto& div = mDivList[id];
+    div.mDirty = false;
+    ++ div.mStamp;
+    int w = div.weight();
+    if ( w > 0 ) {
+      mHeap.push(HeapEntry{w, id, div.mStamp});
+    }
+  }
+  mDirtyList.clear();
+}
+
+// @brief 最も重みの大きな除数を取り出す．
+bool
+AlgFastExtract::_pop(
+  SizeType& id
+)
+{
+  while ( !mHeap.empty() ) {
+    auto entry = mHeap.top();
+    mHeap.pop();
+    if ( entry.mStamp == mDivList[entry.mId].mStamp ) {
+      id = entry.mId;
+      return true;
+    }
+    // 古い要素は捨てる．
+  }
+  return false;
+}
+
+// @brief ビットベクタからカバーを作る．
+AlgCover
+AlgFastExtract::_make_cover(
+  const ymuint64* bv,
+  SizeType cube_num
+)
+{
+  AlgCover ans{mMgr, 0, 0, nullptr};
+  ans.resize(cube_num);
+  mMgr.copy(cube_num, ans.mBody, 0, bv, 0);
+  ans.mCubeNum = mMgr.sort(cube_num, ans.mBody);
+  return ans;
+}
+
+// @brief mKey 用のハッシュ関数
+SizeType
+AlgFastExtract::KeyHash::operator()(
+  const vector<ymuint64>& key
+) const
+{
+  ymuint64 ans = key.size();
+  for ( auto w: key ) {
+    ans ^= w;
+    ans *= 0xBF58476D1CE4E5B9ULL;
+    ans ^= ans >> 31;
+  }
+  return ans;
+}
+
+END_NAMESPACE_YM_BFO
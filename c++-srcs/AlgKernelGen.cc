@@ -3,21 +3,196 @@
 /// @brief AlgKernelGen の実装ファイル
 /// @author Yusuke Matsunaga (松永 裕介)
 ///
-/// Copyright (C) 2017 Yusuke Matsunaga
+/// Copyright (C) 2017, 2022 Yusuke Matsunaga
 /// All rights reserved.
 
 
 #include "ym/AlgKernelGen.h"
+#include "AlgTaskPool.h"
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
 
 
 BEGIN_NAMESPACE_YM_BFO
 
+//////////////////////////////////////////////////////////////////////
+// 複数のスレッドから使うカーネルの表
+//
+// ハッシュ値で分割したシャードごとに排他制御を行う．
+//////////////////////////////////////////////////////////////////////
+class AlgKernelGen::KernelTable
+{
+public:
+
+  // 要素
+  struct Entry
+  {
+    // コカーネルのリスト
+    vector<AlgCube> mCoKernelList;
+
+    // このカーネルをリテラルで割ってキューブフリーにしたもの
+    // (自身以外のカーネル)のリスト
+    // mExpanded を true にしたスレッドのみが書き込む．
+    vector<Entry*> mSubList;
+
+    // mSubList を作ったかどうか
+    bool mExpanded{false};
+
+    // レベル
+    ymuint mLevel{0};
+
+    // レベルを計算したかどうか
+    bool mLevelDone{false};
+  };
+
+  // カーネルとコカーネルを登録する．
+  // 要素を返す．
+  //
+  // expand には最初に登録した場合にのみ true が設定される．
+  // std::unordered_map の要素のアドレスは再ハッシュでも変わらない．
+  Entry*
+  insert(
+    const AlgCover& kernel,
+    const AlgCube& cokernel,
+    bool& expand
+  )
+  {
+    auto& shard = _shard(kernel);
+    std::lock_guard<std::mutex> lock{shard.mMutex};
+    auto& entry = shard.mMap[kernel];
+    entry.mCoKernelList.push_back(cokernel);
+    expand = !entry.mExpanded;
+    entry.mExpanded = true;
+    return &entry;
+  }
+
+  // カーネルのみを登録する．
+  // 要素を返す．
+  Entry*
+  insert(
+    const AlgCover& kernel
+  )
+  {
+    auto& shard = _shard(kernel);
+    std::lock_guard<std::mutex> lock{shard.mMutex};
+    return &shard.mMap[kernel];
+  }
+
+  // 結果を kernel_list に入れる．
+  //
+  // すべてのタスクが終わってから呼ぶ．
+  void
+  get_list(
+    AlgMgr& mgr,
+    vector<AlgKernelInfo>& kernel_list
+  )
+  {
+    for ( auto& shard: mShardArray ) {
+      for ( auto& p: shard.mMap ) {
+	auto& entry = p.second;
+	if ( entry.mCoKernelList.empty() ) {
+	  // 念のため
+	  continue;
+	}
+	kernel_list.push_back(AlgKernelInfo{AlgCover{p.first},
+					    AlgCover{mgr, entry.mCoKernelList},
+					    _level(&entry)});
+      }
+    }
+    // 出力順をスレッドの実行順序に依らないものにする．
+    std::sort(kernel_list.begin(), kernel_list.end(),
+	      [](const AlgKernelInfo& a, const AlgKernelInfo& b) {
+		return a.mKernel < b.mKernel;
+	      });
+  }
+
+
+private:
+
+  // シャード数
+  static
+  const SizeType kShardNum = 64;
+
+  // シャード
+  struct Shard
+  {
+    // 排他制御用のミューテックス
+    std::mutex mMutex;
+
+    // カーネルをキーにしたハッシュ表
+    std::unordered_map<AlgCover, Entry> mMap;
+  };
+
+  // カーネルに対応するシャードを返す．
+  Shard&
+  _shard(
+    const AlgCover& kernel
+  )
+  {
+    return mShardArray[kernel.hash() % kShardNum];
+  }
+
+  // レベルを求める．
+  //
+  // 自身以外のカーネルのレベルの最大値 + 1 となる．
+  // 自身以外のカーネルは必ずリテラルで割ったもののカーネルとなる．
+  ymuint
+  _level(
+    Entry* entry
+  )
+  {
+    if ( !entry->mLevelDone ) {
+      ymuint level = 0;
+      for ( auto sub: entry->mSubList ) {
+	level = std::max(level, _level(sub) + 1);
+      }
+      entry->mLevel = level;
+      entry->mLevelDone = true;
+    }
+    return entry->mLevel;
+  }
+
+  // シャードの配列
+  Shard mShardArray[kShardNum];
+
+};
+
+
+//////////////////////////////////////////////////////////////////////
+// generate() の実行中の情報
+//////////////////////////////////////////////////////////////////////
+class AlgKernelGen::Context
+{
+public:
+
+  // コンストラクタ
+  //
+  // pool が nullptr の時はスレッドを使わずに呼び出したスレッドで処理する．
+  Context(
+    AlgTaskPool* pool
+  ) : mPool{pool}
+  {
+  }
+
+  // タスクプール
+  // 1スレッドの時は nullptr となる．
+  AlgTaskPool* mPool;
+
+  // カーネルの表
+  KernelTable mTable;
+
+};
+
+
 //////////////////////////////////////////////////////////////////////
 // クラス AlgKernelGen
 //////////////////////////////////////////////////////////////////////
 
 // @brief コンストラクタ
-AlgKernelGen::AlgKernelGen()
+AlgKernelGen::AlgKernelGen(
+  SizeType thread_num
+) : mThreadNum{thread_num > 0 ? thread_num : 1}
 {
 }
 
@@ -26,39 +201,86 @@ AlgKernelGen::~AlgKernelGen()
 {
 }
 
+// @brief スレッド数を設定する．
+void
+AlgKernelGen::set_thread_num(
+  SizeType thread_num
+)
+{
+  if ( thread_num == 0 ) {
+    thread_num = 1;
+  }
+  if ( thread_num != mThreadNum ) {
+    mThreadNum = thread_num;
+    // 次の generate() で作り直す．
+    mPool = nullptr;
+  }
+}
+
 // @brief カーネルとコカーネルを列挙する．
-// @param[in] cover 対象のカバー
-// @param[out] kernel_list 結果を格納するリスト
 void
-AlgKernelGen::generate(const AlgCover& cover,
-		       vector<AlgKernelInfo>& kernel_list)
+AlgKernelGen::generate(
+  const AlgCover& cover,
+  vector<AlgKernelInfo>& kernel_list
+)
 {
+  kernel_list.clear();
+
+  AlgMgr& mgr = cover.mgr();
+
   // cover に現れるリテラルの出現頻度の昇順のリストを作る．
+  // 1回しか現れないリテラルで割っても1キューブにしかならないので除外する．
+  mLitList = cover.literal_list_by_frequency(2);
+  mPrevLitsList.clear();
+  AlgLitSet plits{mgr};
+  for ( auto lit: mLitList ) {
+    mPrevLitsList.push_back(plits);
+    plits += lit;
+  }
 
+  // cover 自身もキューブフリーにしたものはカーネルとなる．
+  AlgCube ccube0 = cover.common_cube();
+  AlgCover cover0 = cover / ccube0;
+  if ( cover0.cube_num() < 2 ) {
+    return;
+  }
 
-  AlgCube ccube0(cover.mgr());
-  AlgLitSet plits0(cover.mgr());
-  kern_sub(cover, 0, ccube0, plits0);
+  if ( mThreadNum > 1 && mPool == nullptr ) {
+    mPool.reset(new AlgTaskPool{mThreadNum});
+  }
+  Context ctx{mPool.get()};
+  if ( ctx.mPool == nullptr ) {
+    kern_sub(ctx, std::move(cover0), 0, std::move(ccube0));
+  }
+  else {
+    ctx.mPool->submit([this, &ctx, cover0 = std::move(cover0),
+		       ccube0 = std::move(ccube0)]() mutable {
+      kern_sub(ctx, std::move(cover0), 0, std::move(ccube0));
+    });
+    ctx.mPool->wait();
+  }
 
-  // kernel_list に答を入れる．
+  ctx.mTable.get_list(mgr, kernel_list);
 }
 
 // @brief カーネルを求める下請け関数
-// @param[in] cover 対象のカバー
-// @param[in] pos mLitList 上の位置
-// @param[in] ccube 今までに括りだされた共通のキューブ
-// @param[in] plits mLitList[0]〜mLitList[pos - 1] までをまとめたリテラル集合
-ymuint
-AlgKernelGen::kern_sub(const AlgCover& cover,
-		       ymuint pos,
-		       const AlgCube& ccube,
-		       const AlgLitSet& plits)
+void
+AlgKernelGen::kern_sub(
+  Context& ctx,
+  AlgCover cover,
+  SizeType pos,
+  AlgCube ccube
+)
 {
-  ymuint max_level = 0;
-  AlgLitSet plits1(plits);
-  for (ymuint i = pos; i < mLitList.size(); ++ i) {
+  bool expand;
+  auto entry = ctx.mTable.insert(cover, ccube, expand);
+
+  // 初めて現れたカーネルの場合はレベルを求めるために
+  // mLitList[pos] より前のリテラルで割ったものも記録する．
+  auto hist = cover.literal_histogram();
+  for ( SizeType i = expand ? 0 : pos; i < mLitList.size(); ++ i ) {
     AlgLiteral lit = mLitList[i];
-    if ( cover.literal_num(lit) <= 1 ) {
+    if ( hist[lit.index()] <= 1 ) {
       continue;
     }
 
@@ -66,25 +288,34 @@ AlgKernelGen::kern_sub(const AlgCover& cover,
     AlgCover cover1 = cover / lit;
     // 共通なキューブを求める．
     AlgCube ccube1 = cover1.common_cube();
-    if ( ccube1.contains(plits1) ) {
+    cover1 /= ccube1;
+    if ( expand ) {
+      entry->mSubList.push_back(ctx.mTable.insert(cover1));
+    }
+    if ( i < pos ) {
+      continue;
+    }
+
+    if ( ccube1.contains(mPrevLitsList[i]) ) {
       // これはすでに処理されている．
       continue;
     }
 
-    cover1 /= ccube1;
     ccube1 *= ccube;
-    plits1 += lit;
+    ccube1 *= lit;
 
-    ymuint level = kern_sub(cover1, pos + 1, ccube1, plits1);
-
-    // cover1/ccube1/level を記録．
-
-    if ( max_level < level + 1 ) {
-      max_level = level + 1;
+    // 残りの処理は新たなタスクとして投入する．
+    // 1スレッドの時はその場で再帰呼び出しする．
+    if ( ctx.mPool == nullptr ) {
+      kern_sub(ctx, std::move(cover1), i + 1, std::move(ccube1));
+    }
+    else {
+      ctx.mPool->submit([this, &ctx, i, cover1 = std::move(cover1),
+			 ccube1 = std::move(ccube1)]() mutable {
+	kern_sub(ctx, std::move(cover1), i + 1, std::move(ccube1));
+      });
     }
   }
-
-  return max_level;
 }
 
 END_NAMESPACE_YM_BFO
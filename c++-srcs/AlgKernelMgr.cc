@@ -0,0 +1,134 @@
+
+/// @file AlgKernelMgr.cc
+/// @brief AlgKernelMgr の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/AlgKernelMgr.h"
+#include <algorithm>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+// クラス AlgKernelMgr
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+AlgKernelMgr::AlgKernelMgr(
+  AlgMgr& mgr
+) : mMgr{mgr}
+{
+}
+
+// @brief デストラクタ
+AlgKernelMgr::~AlgKernelMgr()
+{
+}
+
+// @brief カーネルとコカーネルを求める．
+void
+AlgKernelMgr::find_kernels(
+  const AlgCover& cover,
+  bool level0
+)
+{
+  ASSERT_COND( &cover.mgr() == &mMgr );
+
+  _clear();
+  mLevel0 = level0;
+
+  // cover に2回以上現れるリテラルを出現頻度の昇順に並べる．
+  // 頻度の低いリテラルから割ることで浅い再帰で多くの枝を
+  // skip_set で刈ることができる．
+  mLitList = cover.literal_list_by_frequency(2);
+
+  // cover をキューブフリーにしたものもカーネルとなる．
+  AlgCube ckcube = cover.common_cube();
+  AlgCover cover0 = cover / ckcube;
+  if ( cover0.cube_num() < 2 ) {
+    return;
+  }
+  _kernel_sub(cover0, 0, ckcube, AlgLitSet{mMgr});
+}
+
+// @brief mKernelList と mCokernelList をクリアする．
+void
+AlgKernelMgr::_clear()
+{
+  mLitList.clear();
+  mKernelList.clear();
+  mCokernelList.clear();
+  mKernelHash.clear();
+}
+
+// @brief カーネルを求める再帰関数
+void
+AlgKernelMgr::_kernel_sub(
+  const AlgCover& cover,
+  SizeType pos,
+  const AlgCube& ckcube,
+  const AlgLitSet& skip_set
+)
+{
+  auto hist = cover.literal_histogram();
+  if ( mLevel0 ) {
+    // 2回以上現れるリテラルがなければレベル0のカーネル
+    bool is_level0 = true;
+    for ( auto lit: mLitList ) {
+      if ( hist[lit.index()] >= 2 ) {
+	is_level0 = false;
+	break;
+      }
+    }
+    if ( is_level0 ) {
+      _add_kernel(cover, ckcube);
+      return;
+    }
+  }
+  else {
+    _add_kernel(cover, ckcube);
+  }
+
+  AlgLitSet skip_set1{skip_set};
+  for ( SizeType i = pos; i < mLitList.size(); ++ i ) {
+    AlgLiteral lit = mLitList[i];
+    if ( hist[lit.index()] >= 2 ) {
+      AlgCover cover1 = cover / lit;
+      AlgCube ccube1 = cover1.common_cube();
+      // 共通キューブに試し済みのリテラルが含まれていたら
+      // そのカーネルはすでに求められている．
+      if ( !ccube1.contains(skip_set1) ) {
+	cover1 /= ccube1;
+	ccube1 *= ckcube;
+	ccube1 *= lit;
+	_kernel_sub(cover1, i + 1, ccube1, skip_set1 + lit);
+      }
+    }
+    skip_set1 += lit;
+  }
+}
+
+// @brief カーネルを登録する．
+void
+AlgKernelMgr::_add_kernel(
+  const AlgCover& kernel,
+  const AlgCube& ckcube
+)
+{
+  auto p = mKernelHash.find(kernel);
+  if ( p != mKernelHash.end() ) {
+    mCokernelList[p->second] += ckcube;
+  }
+  else {
+    SizeType id = mKernelList.size();
+    mKernelHash.emplace(kernel, id);
+    mKernelList.push_back(kernel);
+    mCokernelList.push_back(AlgCover{mMgr, vector<AlgCube>{ckcube}});
+  }
+}
+
+END_NAMESPACE_YM_BFO
@@ -0,0 +1,236 @@
+
+/// @file AlgLitCount.cc
+/// @brief リテラル数を数える関数の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "AlgLitCount.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ALG_LITCOUNT_X86 1
+#include <immintrin.h>
+#else
+#define ALG_LITCOUNT_X86 0
+#endif
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+BEGIN_NONAMESPACE
+
+// 偶数ビット(負極性のビット)のマスク
+const ymuint64 kMask55 = 0x5555555555555555ULL;
+
+// 1ワード中のリテラルのビットを偶数ビットに集める．
+inline
+ymuint64
+_fold(
+  ymuint64 pat
+)
+{
+  return (pat | (pat >> 1)) & kMask55;
+}
+
+// ポータブルな実装
+//
+// _fold() の結果は2ビットごとに高々1つなので
+// 最初の段は省略できる．
+SizeType
+_count_scalar(
+  const ymuint64* bv,
+  SizeType n
+)
+{
+  SizeType ans = 0;
+  for ( SizeType i = 0; i < n; ++ i ) {
+    ymuint64 x = _fold(bv[i]);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    ans += (x * 0x0101010101010101ULL) >> 56;
+  }
+  return ans;
+}
+
+#if ALG_LITCOUNT_X86
+
+// POPCNT 命令を用いた実装
+__attribute__((target("popcnt")))
+SizeType
+_count_popcnt(
+  const ymuint64* bv,
+  SizeType n
+)
+{
+  SizeType ans = 0;
+  for ( SizeType i = 0; i < n; ++ i ) {
+    ans += __builtin_popcountll(_fold(bv[i]));
+  }
+  return ans;
+}
+
+// AVX2 を用いた実装
+//
+// 4ビットごとの表引き(vpshufb)で数えて vpsadbw で足し合わせる．
+__attribute__((target("avx2,popcnt")))
+SizeType
+_count_avx2(
+  const ymuint64* bv,
+  SizeType n
+)
+{
+  const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3,
+					  1, 2, 2, 3, 2, 3, 3, 4,
+					  0, 1, 1, 2, 1, 2, 2, 3,
+					  1, 2, 2, 3, 2, 3, 3, 4);
+  const __m256i mask4 = _mm256_set1_epi8(0x0F);
+  const __m256i mask55 = _mm256_set1_epi64x(static_cast<long long>(kMask55));
+  __m256i acc = _mm256_setzero_si256();
+  SizeType i = 0;
+  for ( ; i + 4 <= n; i += 4 ) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bv + i));
+    v = _mm256_and_si256(_mm256_or_si256(v, _mm256_srli_epi64(v, 1)), mask55);
+    __m256i lo = _mm256_and_si256(v, mask4);
+    __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), mask4);
+    __m256i c = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo),
+				_mm256_shuffle_epi8(lookup, hi));
+    acc = _mm256_add_epi64(acc, _mm256_sad_epu8(c, _mm256_setzero_si256()));
+  }
+  SizeType ans = _mm256_extract_epi64(acc, 0) + _mm256_extract_epi64(acc, 1)
+    + _mm256_extract_epi64(acc, 2) + _mm256_extract_epi64(acc, 3);
+  for ( ; i < n; ++ i ) {
+    ans += __builtin_popcountll(_fold(bv[i]));
+  }
+  return ans;
+}
+
+// AVX-512 (VPOPCNTDQ) を用いた実装
+//
+// _mm512_srli_epi64() と _mm512_reduce_add_epi64() は GCC の
+// ヘッダ内で未初期化の値を使うので -Wmaybe-uninitialized が出る．
+// そこでシフトはゼロマスク版を使い，最後の足し合わせは
+// メモリに書き出して行う．
+__attribute__((target("avx512f,avx512vpopcntdq,popcnt")))
+SizeType
+_count_avx512(
+  const ymuint64* bv,
+  SizeType n
+)
+{
+  const __m512i mask55 = _mm512_set1_epi64(static_cast<long long>(kMask55));
+  const __mmask8 all = 0xFF;
+  __m512i acc = _mm512_setzero_si512();
+  SizeType i = 0;
+  for ( ; i + 8 <= n; i += 8 ) {
+    __m512i v = _mm512_loadu_si512(bv + i);
+    __m512i v1 = _mm512_maskz_srli_epi64(all, v, 1);
+    v = _mm512_and_si512(_mm512_or_si512(v, v1), mask55);
+    acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(v));
+  }
+  ymuint64 lane[8];
+  _mm512_storeu_si512(lane, acc);
+  SizeType ans = 0;
+  for ( SizeType k = 0; k < 8; ++ k ) {
+    ans += lane[k];
+  }
+  for ( ; i < n; ++ i ) {
+    ans += __builtin_popcountll(_fold(bv[i]));
+  }
+  return ans;
+}
+
+#endif // ALG_LITCOUNT_X86
+
+// 実装を表す関数の型
+using CountFunc = SizeType (*)(const ymuint64*, SizeType);
+
+// 実装の種類に対応する関数を返す．
+// 使えない場合は nullptr を返す．
+CountFunc
+_impl_func(
+  AlgLitCountImpl impl
+)
+{
+#if ALG_LITCOUNT_X86
+  __builtin_cpu_init();
+  switch ( impl ) {
+  case kAlgLitCountScalar:
+    return _count_scalar;
+
+  case kAlgLitCountPopcnt:
+    if ( __builtin_cpu_supports("popcnt") ) {
+      return _count_popcnt;
+    }
+    break;
+
+  case kAlgLitCountAvx2:
+    if ( __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt") ) {
+      return _count_avx2;
+    }
+    break;
+
+  case kAlgLitCountAvx512:
+    if ( __builtin_cpu_supports("avx512f") &&
+	 __builtin_cpu_supports("avx512vpopcntdq") ) {
+      return _count_avx512;
+    }
+    break;
+  }
+  return nullptr;
+#else
+  return impl == kAlgLitCountScalar ? _count_scalar : nullptr;
+#endif
+}
+
+// CPU の機能を調べて実装を選ぶ．
+CountFunc
+_select_func()
+{
+  for ( auto impl: {kAlgLitCountAvx512, kAlgLitCountAvx2, kAlgLitCountPopcnt} ) {
+    auto func = _impl_func(impl);
+    if ( func != nullptr ) {
+      return func;
+    }
+  }
+  return _count_scalar;
+}
+
+END_NONAMESPACE
+
+// @brief ビットベクタ上のリテラル数を数える．
+SizeType
+lit_count(
+  const ymuint64* bv,
+  SizeType n
+)
+{
+  // 選択は最初の呼び出し時に一度だけ行う．
+  static const CountFunc func = _select_func();
+  return (*func)(bv, n);
+}
+
+// @brief 実行中の CPU で指定した実装が使える時 true を返す．
+bool
+lit_count_supported(
+  AlgLitCountImpl impl
+)
+{
+  return _impl_func(impl) != nullptr;
+}
+
+// @brief 実装を指定してビットベクタ上のリテラル数を数える．
+SizeType
+lit_count(
+  const ymuint64* bv,
+  SizeType n,
+  AlgLitCountImpl impl
+)
+{
+  auto func = _impl_func(impl);
+  ASSERT_COND( func != nullptr );
+  return (*func)(bv, n);
+}
+
+END_NAMESPACE_YM_BFO
@@ -0,0 +1,61 @@
+#ifndef ALGLITCOUNT_H
+#define ALGLITCOUNT_H
+
+/// @file AlgLitCount.h
+/// @brief リテラル数を数える関数のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/bfo_nsdef.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+/// @brief ビットベクタ上のリテラル数を数える．
+/// @return リテラル数を返す．
+///
+/// 各変数の2ビット(正極性と負極性)の OR をとって popcount する．<br>
+/// 実行時に CPU の機能を調べて AVX-512(VPOPCNTDQ), AVX2, POPCNT
+/// の中から使えるものを用いる．どれも使えない場合には
+/// 普通の C++ のコードで計算する．
+SizeType
+lit_count(
+  const ymuint64* bv, ///< [in] ビットベクタ
+  SizeType n          ///< [in] ワード数
+);
+
+/// @brief lit_count() の実装の種類
+enum AlgLitCountImpl {
+  /// @brief 普通の C++ のコード
+  kAlgLitCountScalar,
+  /// @brief POPCNT 命令
+  kAlgLitCountPopcnt,
+  /// @brief AVX2
+  kAlgLitCountAvx2,
+  /// @brief AVX-512(VPOPCNTDQ)
+  kAlgLitCountAvx512
+};
+
+/// @brief 実行中の CPU で指定した実装が使える時 true を返す．
+bool
+lit_count_supported(
+  AlgLitCountImpl impl ///< [in] 実装の種類
+);
+
+/// @brief 実装を指定してビットベクタ上のリテラル数を数える．
+/// @return リテラル数を返す．
+///
+/// lit_count_supported(impl) が true の時のみ呼んでよい．
+/// 各実装の結果を比べるテスト用の関数．
+SizeType
+lit_count(
+  const ymuint64* bv,  ///< [in] ビットベクタ
+  SizeType n,          ///< [in] ワード数
+  AlgLitCountImpl impl ///< [in] 実装の種類
+);
+
+END_NAMESPACE_YM_BFO
+
+#endif // ALGLITCOUNT_H
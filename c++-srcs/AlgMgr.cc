@@ -10,6 +10,12 @@
 #include "ym/AlgMgr.h"
 #include "ym/AlgCover.h"
 #include "ym/AlgCube.h"
+#include "AlgLitCount.h"
+#include "AlgBodyAlloc.h"
+#include "AlgWorkspace.h"
+#include "AlgCubeOps.h"
+#include "AlgOpCache.h"
+#include <algorithm>
 
 
 BEGIN_NAMESPACE_YM_BFO
@@ -31,6 +37,130 @@ _varname(
   return ans;
 }
 
+// デフォルトの変数名のリストを作る．
+// 変数番号を26進数で表して文字列にする．
+vector<string>
+_varname_list(
+  SizeType variable_num
+)
+{
+  vector<string> ans(variable_num);
+  for ( SizeType i = 0; i < variable_num; ++ i ) {
+    ans[i] = _varname(i);
+  }
+  return ans;
+}
+
+// 変数名のハッシュ値の初期値(FNV-1a)
+const ymuint64 kNameHashInit = 0xCBF29CE484222325ULL;
+
+// 変数名のハッシュ値を1文字分更新する．
+inline
+ymuint64
+_name_hash(
+  ymuint64 hash,
+  char c
+)
+{
+  return (hash ^ static_cast<unsigned char>(c)) * 0x100000001B3ULL;
+}
+
+// 変数名のハッシュ値を計算する．
+ymuint64
+_name_hash(
+  std::string_view name
+)
+{
+  ymuint64 hash = kNameHashInit;
+  for ( char c: name ) {
+    hash = _name_hash(hash, c);
+  }
+  return hash;
+}
+
+// 変数名から変数番号を引くハッシュ表を作る．
+// 線形探査のオープンアドレス法を用いる．
+// 空きスロットには varname_list.size() を入れておく．
+// 同じ名前が複数あった場合には最初のものを登録する．
+vector<SizeType>
+_var_hash_table(
+  const vector<string>& varname_list
+)
+{
+  SizeType n = varname_list.size();
+  SizeType size = 16;
+  while ( size < n * 2 ) {
+    size <<= 1;
+  }
+  SizeType mask = size - 1;
+  vector<SizeType> ans(size, n);
+  for ( SizeType i = 0; i < n; ++ i ) {
+    const auto& name = varname_list[i];
+    for ( SizeType pos = _name_hash(name) & mask; ; pos = (pos + 1) & mask ) {
+      if ( ans[pos] == n ) {
+	ans[pos] = i;
+	break;
+      }
+      if ( varname_list[ans[pos]] == name ) {
+	break;
+      }
+    }
+  }
+  return ans;
+}
+
+// ビット位置からリテラル番号(AlgLiteral::index())を求める．
+inline
+SizeType
+_lit_index(
+  SizeType blk, ///< [in] ブロック位置
+  SizeType bit  ///< [in] ブロック内のビット位置(LSB が 0)
+)
+{
+  // 変数は MSB 側から並んでいる．
+  // 下位のビットが負極性(kAlgPolN)を表す．
+  SizeType var = blk * 32 + 31 - (bit / 2);
+  return var * 2 + ((bit & 1) == 0 ? 1 : 0);
+}
+
+// ハッシュ関数の1ワード分の更新を行う．
+inline
+ymuint64
+_hash_mix(
+  ymuint64 x
+)
+{
+  const ymuint64 kP0 = 0xA0761D6478BD642FULL;
+  const ymuint64 kP1 = 0xE7037ED1A0B428DBULL;
+  unsigned __int128 r = static_cast<unsigned __int128>(x ^ kP0) * kP1;
+  return static_cast<ymuint64>(r >> 64) ^ static_cast<ymuint64>(r);
+}
+
+// 偶数ビット(負極性のビット)のマスク
+const ymuint64 kMask55 = 0x5555555555555555ULL;
+
+// 奇数ビット(正極性のビット)のマスク
+const ymuint64 kMaskAA = 0xAAAAAAAAAAAAAAAAULL;
+
+// キューブごとのシグネチャ(全ワードの OR)を求める．
+inline
+void
+_cube_signature(
+  ymuint64* sig,
+  SizeType nc,
+  const ymuint64* bv,
+  SizeType nb
+)
+{
+  for ( SizeType i = 0; i < nc; ++ i, bv += nb ) {
+    ymuint64 tmp = 0ULL;
+    for ( SizeType k = 0; k < nb; ++ k ) {
+      tmp |= bv[k];
+    }
+    sig[i] = tmp;
+  }
+}
+
 END_NONAMESPACE
 
 const AlgLiteral AlgLiteralUndef;
@@ -43,71 +173,32 @@ const AlgLiteral AlgLiteralUndef;
 AlgMgr::AlgMgr(
   SizeType variable_num
 ) : mVarNum{variable_num},
-    mVarNameList(mVarNum)
+    mVarNameList{_varname_list(variable_num)},
+    mVarHashTable{_var_hash_table(mVarNameList)},
+    mCubeOps{AlgCubeOps::get(_cube_size())},
+    mAlloc{new AlgBodyAlloc{_cube_size()}},
+    mWorkspaceTable{new AlgWorkspaceTable}
 {
-  // 変数名を作る．
-  // 変数番号を26進数で表して文字列にする．
-  for ( SizeType i = 0; i < mVarNum; ++ i ) {
-    string name = _varname(i);
-    mVarNameList[i] = name;
-    mVarNameMap.emplace(name, i);
-  }
-
-  _init_buff();
 }
 
 // @brief コンストラクタ
 AlgMgr::AlgMgr(
   const vector<string>& varname_list
 ) : mVarNum{varname_list.size()},
-    mVarNameList{varname_list}
+    mVarNameList{varname_list},
+    mVarHashTable{_var_hash_table(mVarNameList)},
+    mCubeOps{AlgCubeOps::get(_cube_size())},
+    mAlloc{new AlgBodyAlloc{_cube_size()}},
+    mWorkspaceTable{new AlgWorkspaceTable}
 {
-  // 変数名を登録する．
-  for ( SizeType i = 0; i < mVarNum; ++ i ) {
-    mVarNameMap.emplace(mVarNameList[i], i);
-  }
-
-  _init_buff();
 }
 
 // @brief デストラクタ
 AlgMgr::~AlgMgr()
 {
-  delete_body(mTmpBuff, mTmpBuffSize);
-}
-
-BEGIN_NONAMESPACE
-
-// 表引きを使ってリテラル数の計算を行う．
-SizeType
-_count(ymuint64 pat)
-{
-  SizeType table[] = {
-    // utils/gen_bitcount_tbl.py で生成
-    0,  1,  1,  0,  1,  2,  2,  0,  1,  2,  2,  0,  0,  0,  0,  0,
-    1,  2,  2,  0,  2,  3,  3,  0,  2,  3,  3,  0,  0,  0,  0,  0,
-    1,  2,  2,  0,  2,  3,  3,  0,  2,  3,  3,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    1,  2,  2,  0,  2,  3,  3,  0,  2,  3,  3,  0,  0,  0,  0,  0,
-    2,  3,  3,  0,  3,  4,  4,  0,  3,  4,  4,  0,  0,  0,  0,  0,
-    2,  3,  3,  0,  3,  4,  4,  0,  3,  4,  4,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    1,  2,  2,  0,  2,  3,  3,  0,  2,  3,  3,  0,  0,  0,  0,  0,
-    2,  3,  3,  0,  3,  4,  4,  0,  3,  4,  4,  0,  0,  0,  0,  0,
-    2,  3,  3,  0,  3,  4,  4,  0,  3,  4,  4,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-
-  };
-
-  return table[pat];
+  // 確保した領域は mAlloc のデストラクタでまとめて解放される．
 }
 
-END_NONAMESPACE
-
 // @brief ビットベクタ上のリテラル数を数える．
 SizeType
 AlgMgr::literal_num(
@@ -115,29 +206,9 @@ AlgMgr::literal_num(
   const ymuint64* bv
 )
 {
-  SizeType n = nc * _cube_size();
-  // 8 ビットごとに区切って表引きで計算する．
-  SizeType ans = 0;
-  for ( SizeType i = 0; i < n; ++ i, ++ bv ) {
-    ymuint64 pat = *bv;
-    ymuint64 p1 = pat & 0xFFUL;
-    ans += _count(p1);
-    ymuint64 p2 = (pat >> 8) & 0xFFUL;
-    ans += _count(p2);
-    ymuint64 p3 = (pat >> 16) & 0xFFUL;
-    ans += _count(p3);
-    ymuint64 p4 = (pat >> 24) & 0xFFUL;
-    ans += _count(p4);
-    ymuint64 p5 = (pat >> 32) & 0xFFUL;
-    ans += _count(p5);
-    ymuint64 p6 = (pat >> 40) & 0xFFUL;
-    ans += _count(p6);
-    ymuint64 p7 = (pat >> 48) & 0xFFUL;
-    ans += _count(p7);
-    ymuint64 p8 = (pat >> 56);
-    ans += _count(p8);
-  }
-  return ans;
+  // 正極性と負極性のビットの OR を popcount する．
+  // 実際の計算は CPU に応じて選ばれた lit_count() が行う．
+  return lit_count(bv, nc * _cube_size());
 }
 
 // @brief ビットベクタ上の特定のリテラルの出現頻度を数える．
@@ -162,18 +233,138 @@ AlgMgr::literal_num(
   return n;
 }
 
+// @brief ビットベクタ上の全リテラルの出現頻度を数える．
+void
+AlgMgr::literal_histogram(
+  SizeType nc,
+  const ymuint64* bv,
+  vector<SizeType>& counts
+)
+{
+  counts.assign(variable_num() * 2, 0);
+
+  // ブロックごとにビット単位の縦方向のカウンタを持ち，
+  // 4キューブずつ carry-save adder で足し込む．
+  // - ones, twos は重み 1, 2 の桁を表す．
+  // - 重み 4 以上の桁は slice[0] 〜 slice[kSliceNum - 1] で表し，
+  //   4キューブごとに1回だけ桁上げ(リプルキャリー)を行う．
+  // - slice があふれる前に counts に書き出す．
+  const SizeType kSliceNum = 16;
+  const SizeType kFlushNum = (1 << kSliceNum) - 1;
+  const SizeType kStateSize = kSliceNum + 2;
+  SizeType nb = _cube_size();
+  AlgWorkspace::Frame state_frame{_workspace(), nb * kStateSize};
+  ymuint64* state = state_frame.body();
+  for ( SizeType i = 0; i < nb * kStateSize; ++ i ) {
+    state[i] = 0ULL;
+  }
+
+  // 重み weight のビットを counts に足し込む．
+  auto add_bits = [&](SizeType blk, ymuint64 pat, SizeType weight) {
+    for ( ; pat != 0ULL; pat &= pat - 1 ) {
+      counts[_lit_index(blk, __builtin_ctzll(pat))] += weight;
+    }
+  };
+  // slice の内容を counts に書き出してクリアする．
+  auto flush = [&]() {
+    for ( SizeType blk = 0; blk < nb; ++ blk ) {
+      ymuint64* slice = state + blk * kStateSize + 2;
+      for ( SizeType k = 0; k < kSliceNum; ++ k ) {
+	add_bits(blk, slice[k], 4 << k);
+	slice[k] = 0ULL;
+      }
+    }
+  };
+
+  SizeType group_num = 0;
+  for ( SizeType i = 0; i < nc; i += 4 ) {
+    // 末尾の4個に満たない部分は 0 で埋めたものとみなす．
+    const ymuint64* c0 = bv + i * nb;
+    SizeType n = std::min(nc - i, static_cast<SizeType>(4));
+    for ( SizeType blk = 0; blk < nb; ++ blk ) {
+      ymuint64 a0 = c0[blk];
+      ymuint64 a1 = n > 1 ? c0[nb + blk] : 0ULL;
+      ymuint64 a2 = n > 2 ? c0[nb * 2 + blk] : 0ULL;
+      ymuint64 a3 = n > 3 ? c0[nb * 3 + blk] : 0ULL;
+      ymuint64* st = state + blk * kStateSize;
+      ymuint64& ones = st[0];
+      ymuint64& twos = st[1];
+      ymuint64* slice = st + 2;
+      // ones + a0 + a1 = ones' + 2 * twos_a
+      ymuint64 u = ones ^ a0;
+      ymuint64 twos_a = (ones & a0) | (u & a1);
+      ones = u ^ a1;
+      // ones + a2 + a3 = ones' + 2 * twos_b
+      u = ones ^ a2;
+      ymuint64 twos_b = (ones & a2) | (u & a3);
+      ones = u ^ a3;
+      // twos + twos_a + twos_b = twos' + 2 * fours
+      u = twos ^ twos_a;
+      ymuint64 fours = (twos & twos_a) | (u & twos_b);
+      twos = u ^ twos_b;
+      // fours を slice に足し込む．
+      for ( SizeType k = 0; fours != 0ULL; ++ k ) {
+	ymuint64 carry = slice[k] & fours;
+	slice[k] ^= fours;
+	fours = carry;
+      }
+    }
+    ++ group_num;
+    if ( group_num == kFlushNum ) {
+      flush();
+      group_num = 0;
+    }
+  }
+  flush();
+  for ( SizeType blk = 0; blk < nb; ++ blk ) {
+    add_bits(blk, state[blk * kStateSize + 0], 1);
+    add_bits(blk, state[blk * kStateSize + 1], 2);
+  }
+}
+
+// @brief 指定回数以上現れるリテラルを出現頻度の昇順に並べる．
+void
+AlgMgr::literal_list_by_frequency(
+  SizeType nc,
+  const ymuint64* bv,
+  SizeType min_num,
+  vector<AlgLiteral>& lit_list
+)
+{
+  vector<SizeType> counts;
+  literal_histogram(nc, bv, counts);
+  vector<pair<SizeType, AlgLiteral>> tmp_list;
+  for ( SizeType var = 0; var < variable_num(); ++ var ) {
+    for ( bool inv: {false, true} ) {
+      AlgLiteral lit{static_cast<int>(var), inv};
+      SizeType n = counts[lit.index()];
+      if ( n >= min_num ) {
+	tmp_list.push_back(make_pair(n, lit));
+      }
+    }
+  }
+  std::sort(tmp_list.begin(), tmp_list.end(),
+	    [](const pair<SizeType, AlgLiteral>& a,
+	       const pair<SizeType, AlgLiteral>& b) {
+	      if ( a.first != b.first ) {
+		return a.first < b.first;
+	      }
+	      return a.second.index() < b.second.index();
+	    });
+  lit_list.clear();
+  lit_list.reserve(tmp_list.size());
+  for ( auto& p: tmp_list ) {
+    lit_list.push_back(p.second);
+  }
+}
+
 // @brief キューブ/カバー用の領域を確保する．
 ymuint64*
 AlgMgr::new_body(
   SizeType cube_num
 )
 {
-  SizeType size = _cube_size() * cube_num;
-  ymuint64* body = new ymuint64[size];
-  for ( SizeType i = 0; i < size; ++ i ) {
-    body[i] = 0ULL;
-  }
-  return body;
+  return mAlloc->get(cube_num);
 }
 
 // @brief キューブ/カバー用の領域を削除する．
@@ -183,7 +374,77 @@ AlgMgr::delete_body(
   SizeType cube_num
 )
 {
-  delete [] p;
+  mAlloc->put(p, cube_num);
+}
+
+// @brief new_body()/delete_body() の統計情報を返す．
+AlgAllocStats
+AlgMgr::alloc_stats() const
+{
+  return mAlloc->stats();
+}
+
+// @brief 呼び出したスレッドの作業領域の統計情報を返す．
+const AlgWorkspaceStats&
+AlgMgr::workspace_stats() const
+{
+  return _workspace().stats();
+}
+
+// @brief 作業領域を持っているスレッド数を返す．
+SizeType
+AlgMgr::workspace_num() const
+{
+  return mWorkspaceTable->size();
+}
+
+// @brief 演算結果のキャッシュを有効にする．
+void
+AlgMgr::enable_op_cache(
+  SizeType limit_words
+)
+{
+  mOpCache.reset(new AlgOpCache{limit_words});
+}
+
+// @brief 演算結果のキャッシュを無効にする．
+void
+AlgMgr::disable_op_cache()
+{
+  mOpCache.reset();
+}
+
+// @brief 演算結果のキャッシュの統計情報を返す．
+AlgOpCacheStats
+AlgMgr::op_cache_stats() const
+{
+  if ( mOpCache == nullptr ) {
+    return AlgOpCacheStats{};
+  }
+  return mOpCache->stats();
+}
+
+// @brief 呼び出したスレッド用の作業領域を返す．
+AlgWorkspace&
+AlgMgr::_workspace() const
+{
+  return mWorkspaceTable->get();
+}
+
+// @brief 演算結果のキャッシュ用のハッシュ値を求める．
+SizeType
+AlgMgr::_op_hash(
+  int op,
+  SizeType nc1,
+  const ymuint64* bv1,
+  SizeType nc2,
+  const ymuint64* bv2
+)
+{
+  // 2つの被演算子の境目がわかるように nc1 も混ぜる．
+  SizeType h = hash_append(kHashInit + op, nc1, bv1);
+  h = hash_append(h ^ nc1, nc2, bv2);
+  return h;
 }
 
 
@@ -197,7 +458,7 @@ is_validchar(
 )
 {
   // utils/gen_validchar_tbl.py で生成
-  bool table[] = {
+  static const bool table[] = {
    false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false,
    false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false,
    false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false,
@@ -215,7 +476,7 @@ is_validchar(
    false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false,
    false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false,
   };
-  return table[c];
+  return table[static_cast<unsigned char>(c)];
 }
 
 END_NONAMESPACE
@@ -228,81 +489,153 @@ AlgMgr::parse(
 )
 {
   lit_list.clear();
+  SizeType err_pos;
+  return _parse(std::string_view{str}, &lit_list, nullptr, err_pos);
+}
 
-  char c;
-  string name;
-  SizeType var;
-
-  // 有限状態機械で実装する．
-  // なんか書いててスッキリしないコード
- state0:
-  c = *str;
-  // EOF なら終わる．
-  if ( c == '\0' ) {
-    goto state_end;
-  }
-  // 空白文字ならこの状態にとどまる．
-  if ( isspace(c) ) {
-    ++ str;
-    goto state0;
-  }
-  // [a-zA-Z0-9_] なら state1 に遷移する．
-  if ( is_validchar(c) ) {
-    name = string();
-    goto state1;
-  }
-  // '+' ならキューブの区切りマークを追加する．
-  if ( c == '+' ) {
-    ++ str;
-    lit_list.push_back(AlgLiteralUndef);
-    goto state0;
-  }
-  // それ以外はエラー
-  goto state_error;
-
- state1:
-  c = *str;
-  // [a-zA-Z0-9_]* ならこの状態にとどまる．
-  if ( is_validchar(c) ) {
-    name += c;
-    ++ str;
-    goto state1;
-  }
-  // ' なら inv をセットしたあとで name を処理する．
-  if ( c == '\'' ) {
-    ++ str;
-    if ( mVarNameMap.count(name) == 0 ) {
-      goto state_error;
-    }
-    var = mVarNameMap.at(name);
-    lit_list.push_back(AlgLiteral(var, true));
-    goto state0;
-  }
-  // それ以外なら一旦現在の name を登録する．
-  if ( mVarNameMap.count(name) == 0 ) {
-    goto state_error;
-  }
-  var = mVarNameMap.at(name);
-  lit_list.push_back(AlgLiteral(var, false));
-  goto state0;
-
- state_error:
-  lit_list.clear();
-  return 0;
+// @brief カバー/キューブを表す文字列をパーズしてビットベクタに書き込む．
+SizeType
+AlgMgr::parse(
+  std::string_view str,
+  ymuint64* dst_bv,
+  SizeType& err_pos
+)
+{
+  return _parse(str, nullptr, dst_bv, err_pos);
+}
+
+// @brief parse() の結果のキューブ数の上限を返す．
+SizeType
+AlgMgr::parse_cube_num(
+  std::string_view str
+)
+{
+  return std::count(str.begin(), str.end(), '+') + 1;
+}
 
- state_end:
+// @brief parse() の本体
+SizeType
+AlgMgr::_parse(
+  std::string_view str,
+  vector<AlgLiteral>* lit_list,
+  ymuint64* dst_bv,
+  SizeType& err_pos
+)
+{
+  SizeType nb = _cube_size();
+  const char* top = str.data();
+  const char* end = top + str.size();
+  const char* p = top;
+  ymuint64* dst = dst_bv;
   SizeType cube_num = 0;
-  bool first = true;
-  for ( auto lit: lit_list ) {
-    if ( lit == AlgLiteralUndef ) {
-      first = true;
+  // 現在のキューブのリテラル数
+  SizeType lit_num = 0;
+  // 最後の '+' の位置
+  const char* plus_pos = nullptr;
+  for ( ; ; ) {
+    // 空白を読み飛ばす．
+    while ( p < end && isspace(static_cast<unsigned char>(*p)) ) {
+      ++ p;
+    }
+    if ( p == end ) {
+      break;
     }
-    else if ( first ) {
-      first = false;
+    char c = *p;
+    if ( c == '+' ) {
+      // 空のキューブは認めない．
+      if ( lit_num == 0 ) {
+	break;
+      }
+      if ( lit_list != nullptr ) {
+	lit_list->push_back(AlgLiteralUndef);
+      }
+      if ( dst != nullptr ) {
+	dst += nb;
+      }
       ++ cube_num;
+      lit_num = 0;
+      plus_pos = p;
+      ++ p;
+      continue;
+    }
+    if ( !is_validchar(c) ) {
+      break;
+    }
+
+    // 変数名を読みながらハッシュ値を計算する．
+    const char* name_top = p;
+    ymuint64 hash = kNameHashInit;
+    for ( ; p < end && is_validchar(*p); ++ p ) {
+      hash = _name_hash(hash, *p);
+    }
+    std::string_view name{name_top, static_cast<SizeType>(p - name_top)};
+    SizeType var = _find_var(name, hash);
+    if ( var == variable_num() ) {
+      p = name_top;
+      break;
+    }
+    bool inv = false;
+    if ( p < end && *p == '\'' ) {
+      inv = true;
+      ++ p;
+    }
+
+    if ( lit_list != nullptr ) {
+      lit_list->push_back(AlgLiteral(var, inv));
+    }
+    if ( dst != nullptr ) {
+      if ( lit_num == 0 ) {
+	for ( SizeType i = 0; i < nb; ++ i ) {
+	  dst[i] = 0ULL;
+	}
+      }
+      ymuint64 pat = inv ? kAlgPolN : kAlgPolP;
+      dst[_block_pos(var)] |= (pat << _shift_num(var));
+    }
+    ++ lit_num;
+  }
+
+  if ( p == end && lit_num == 0 && cube_num > 0 ) {
+    // 末尾が '+' だった．
+    p = plus_pos;
+  }
+  err_pos = p - top;
+  if ( p < end ) {
+    if ( lit_list != nullptr ) {
+      lit_list->clear();
+    }
+    return 0;
+  }
+  if ( lit_num == 0 ) {
+    // 空文字列
+    return 0;
+  }
+  return cube_num + 1;
+}
+
+// @brief 変数名から変数番号を求める．
+SizeType
+AlgMgr::varid(
+  std::string_view name
+) const
+{
+  return _find_var(name, _name_hash(name));
+}
+
+// @brief 変数名のハッシュ表を探す．
+SizeType
+AlgMgr::_find_var(
+  std::string_view name,
+  SizeType hash
+) const
+{
+  SizeType mask = mVarHashTable.size() - 1;
+  for ( SizeType pos = hash & mask; ; pos = (pos + 1) & mask ) {
+    SizeType var = mVarHashTable[pos];
+    if ( var == mVarNum || mVarNameList[var] == name ) {
+      return var;
     }
   }
-  return cube_num;
 }
 
 // @brief リテラルをセットする．
@@ -340,9 +673,11 @@ AlgMgr::sum(
 )
 {
   // dst_bv == bv1 の時は bv1 のコピーを作る．
-  _resize_buff(nc1);
-  copy(nc1, mTmpBuff, 0, bv1, 0);
-  bv1 = mTmpBuff;
+  AlgWorkspace::Frame frame{_workspace(), dst_bv == bv1 ? nc1 * _cube_size() : 0};
+  if ( dst_bv == bv1 ) {
+    copy(nc1, frame.body(), 0, bv1, 0);
+    bv1 = frame.body();
+  }
 
   SizeType rpos1 = 0;
   SizeType rpos2 = 0;
@@ -425,23 +760,133 @@ AlgMgr::product(
   const ymuint64* bv2
 )
 {
-  // dst_bv == bv1 の時は bv1 のコピーを作る．
-  _resize_buff(nc1);
-  copy(nc1, mTmpBuff, 0, bv1, 0);
-  bv1 = mTmpBuff;
+  if ( mOpCache == nullptr ) {
+    return _product(dst_bv, nc1, bv1, nc2, bv2);
+  }
+
+  SizeType nb = _cube_size();
+  SizeType h = _op_hash(AlgOpCache::kProduct, nc1, bv1, nc2, bv2);
+  SizeType dst_nc;
+  SizeType rem_nc;
+  if ( mOpCache->get(AlgOpCache::kProduct, h, nb, nc1, bv1, nc2, bv2,
+		     dst_bv, dst_nc, nullptr, rem_nc) ) {
+    return dst_nc;
+  }
+
+  // 登録するまで被演算子を残しておく．
+  AlgWorkspace::Frame frame1{_workspace(), dst_bv == bv1 ? nc1 * nb : 0};
+  AlgWorkspace::Frame frame2{_workspace(), dst_bv == bv2 && bv1 != bv2 ? nc2 * nb : 0};
+  if ( dst_bv == bv2 ) {
+    if ( bv1 == bv2 ) {
+      copy(nc1, frame1.body(), 0, bv1, 0);
+      bv1 = bv2 = frame1.body();
+    }
+    else {
+      copy(nc2, frame2.body(), 0, bv2, 0);
+      bv2 = frame2.body();
+    }
+  }
+  if ( dst_bv == bv1 ) {
+    copy(nc1, frame1.body(), 0, bv1, 0);
+    bv1 = frame1.body();
+  }
+  dst_nc = _product(dst_bv, nc1, bv1, nc2, bv2);
+  mOpCache->put(AlgOpCache::kProduct, h, nb, nc1, bv1, nc2, bv2,
+		dst_nc, dst_bv, 0, nullptr);
+  return dst_nc;
+}
+
+// @brief 2つのカバーの論理積を計算する．
+SizeType
+AlgMgr::_product(
+  ymuint64* dst_bv,
+  SizeType nc1,
+  const ymuint64* bv1,
+  SizeType nc2,
+  const ymuint64* bv2
+)
+{
+  // dst_bv が bv1 や bv2 と同じ時はコピーを作る．
+  // 両方と同じ時は1つのコピーを共有する．
+  AlgWorkspace::Frame frame1{_workspace(), dst_bv == bv1 ? nc1 * _cube_size() : 0};
+  AlgWorkspace::Frame frame2{_workspace(),
+			     dst_bv == bv2 && bv1 != bv2 ? nc2 * _cube_size() : 0};
+  if ( dst_bv == bv2 ) {
+    if ( bv1 == bv2 ) {
+      copy(nc1, frame1.body(), 0, bv1, 0);
+      bv1 = bv2 = frame1.body();
+    }
+    else {
+      copy(nc2, frame2.body(), 0, bv2, 0);
+      bv2 = frame2.body();
+    }
+  }
+  if ( dst_bv == bv1 ) {
+    copy(nc1, frame1.body(), 0, bv1, 0);
+    bv1 = frame1.body();
+  }
+
+  if ( nc1 == 0 || nc2 == 0 ) {
+    return 0;
+  }
+
+  // 各キューブのシグネチャとして全ワードの OR を求めておく．
+  // 2つのシグネチャの OR に相反するリテラルがなければ積は空でない．
+  // 1ワードの場合はシグネチャがキューブそのものなので
+  // シグネチャだけで正確に判定できる．
+  SizeType nb = _cube_size();
+  AlgWorkspace::Frame sig1_frame{_workspace(), nc1};
+  ymuint64* sig1 = sig1_frame.body();
+  _cube_signature(sig1, nc1, bv1, nb);
+  AlgWorkspace::Frame sig2_frame{_workspace(), nc2};
+  ymuint64* sig2 = sig2_frame.body();
+  _cube_signature(sig2, nc2, bv2, nb);
+
+  // bv2 を kTileWords ワードずつのタイルに分けて，
+  // タイルがキャッシュに載っている間に bv1 の全キューブとの積を求める．
+  const SizeType kTileWords = 4096;
+  SizeType tile = nb < kTileWords ? kTileWords / nb : 1;
+  AlgWorkspace::Frame conflict_frame{_workspace(), tile};
+  ymuint64* conflict = conflict_frame.body();
 
   // 単純には答の積項数は2つの積項数の積だが
   // 相反するリテラルを含む積は数えない．
   SizeType wpos = 0;
-  for ( SizeType rpos1 = 0; rpos1 < nc1; ++ rpos1 ) {
-    for ( SizeType rpos2 = 0; rpos2 < nc2; ++ rpos2 ) {
-      if ( cube_product(dst_bv, wpos, bv1, rpos1, bv2, rpos2) ) {
+  for ( SizeType j0 = 0; j0 < nc2; j0 += tile ) {
+    SizeType n = std::min(tile, nc2 - j0);
+    const ymuint64* tile_sig = sig2 + j0;
+    const ymuint64* tile_bv = bv2 + j0 * nb;
+    for ( SizeType i = 0; i < nc1; ++ i ) {
+      // 分岐のないループなのでコンパイラがベクトル化できる．
+      ymuint64 s1 = sig1[i];
+      for ( SizeType j = 0; j < n; ++ j ) {
+	ymuint64 tmp = s1 | tile_sig[j];
+	conflict[j] = (tmp & kMask55) & ((tmp & kMaskAA) >> 1);
+      }
+      const ymuint64* c1 = bv1 + i * nb;
+      for ( SizeType j = 0; j < n; ++ j ) {
+	const ymuint64* c2 = tile_bv + j * nb;
+	ymuint64* dst = dst_bv + wpos * nb;
+	if ( conflict[j] != 0ULL ) {
+	  // 複数ワードの場合はシグネチャが衝突しても
+	  // 実際には相反していないことがある．
+	  if ( nb == 1 || !mCubeOps->product(dst, c1, c2, nb) ) {
+	    continue;
+	  }
+	}
+	else {
+	  for ( SizeType k = 0; k < nb; ++ k ) {
+	    dst[k] = c1[k] | c2[k];
+	  }
+	}
 	++ wpos;
       }
     }
   }
 
-  return wpos;
+  // 積の順序は入力の順序と無関係なので整列し直す．
+  // 重複したキューブもここで取り除かれる．
+  return sort(wpos, dst_bv);
 }
 
 // @brief カバーとリテラルとの論理積を計算する．
@@ -462,91 +907,361 @@ AlgMgr::product(
   ymuint64 nmask = ~mask;
   SizeType nb = _cube_size();
 
-  // 単純には答の積項数は2つの積項数の積だが
-  // 相反するリテラルを含む積は数えない．
-  SizeType wpos = 0;
-  for ( SizeType rpos1 = 0; rpos1 < nc1; ++ rpos1 ) {
-    SizeType rbase = rpos1 * nb;
-    ymuint64 tmp = bv1[rbase + blk] | pat1;
-    if ( (tmp & mask) == mask ) {
-      // 相反するリテラルがあった．
-      continue;
-    }
-    SizeType wbase = wpos * nb;
-    for ( SizeType i = 0; i < nb; ++ i ) {
-      dst_bv[wbase] = bv1[rbase];
+  // 単純には答の積項数は2つの積項数の積だが
+  // 相反するリテラルを含む積は数えない．
+  // lit を含むキューブがなければ全てのキューブに同じビットを
+  // 足すだけなので順序は変わらず，重複も生じない．
+  SizeType wpos = 0;
+  bool has_lit = false;
+  for ( SizeType rpos1 = 0; rpos1 < nc1; ++ rpos1 ) {
+    SizeType rbase = rpos1 * nb;
+    ymuint64 old = bv1[rbase + blk];
+    ymuint64 tmp = old | pat1;
+    if ( (tmp & mask) == mask ) {
+      // 相反するリテラルがあった．
+      continue;
+    }
+    if ( (old & pat1) != 0ULL ) {
+      has_lit = true;
+    }
+    SizeType wbase = wpos * nb;
+    for ( SizeType i = 0; i < nb; ++ i ) {
+      dst_bv[wbase + i] = bv1[rbase + i];
+    }
+    dst_bv[wbase + blk] = tmp;
+    ++ wpos;
+  }
+
+  if ( has_lit ) {
+    return sort(wpos, dst_bv);
+  }
+  return wpos;
+}
+
+BEGIN_NONAMESPACE
+
+// ハッシュ表の空きを表す値
+const ymuint64 kEmptySlot = ~0ULL;
+
+// n 以上の2のべき乗を求める．
+inline
+SizeType
+_hash_size(
+  SizeType n
+)
+{
+  SizeType size = 16;
+  while ( size < n ) {
+    size <<= 1;
+  }
+  return size;
+}
+
+END_NONAMESPACE
+
+// @brief カバーの代数的除算を行う．
+SizeType
+AlgMgr::division(
+  ymuint64* dst_bv,
+  SizeType nc1,
+  const ymuint64* bv1,
+  SizeType nc2,
+  const ymuint64* bv2,
+  const ymuint64* sig1,
+  const ymuint64* sig2
+)
+{
+  SizeType rem_nc;
+  return division(dst_bv, nullptr, rem_nc, nc1, bv1, nc2, bv2, sig1, sig2);
+}
+
+// @brief カバーの代数的除算を行い，剰余も求める．
+SizeType
+AlgMgr::division(
+  ymuint64* dst_bv,
+  ymuint64* rem_bv,
+  SizeType& rem_nc,
+  SizeType nc1,
+  const ymuint64* bv1,
+  SizeType nc2,
+  const ymuint64* bv2,
+  const ymuint64* sig1,
+  const ymuint64* sig2
+)
+{
+  if ( mOpCache == nullptr ) {
+    return _division(dst_bv, rem_bv, rem_nc, nc1, bv1, nc2, bv2, sig1, sig2);
+  }
+
+  SizeType nb = _cube_size();
+  auto op = rem_bv == nullptr ? AlgOpCache::kDivision : AlgOpCache::kDivRem;
+  SizeType h = _op_hash(op, nc1, bv1, nc2, bv2);
+  SizeType dst_nc;
+  if ( mOpCache->get(op, h, nb, nc1, bv1, nc2, bv2,
+		     dst_bv, dst_nc, rem_bv, rem_nc) ) {
+    return dst_nc;
+  }
+
+  // 登録するまで被演算子を残しておく．
+  bool alias1 = dst_bv == bv1 || (rem_bv != nullptr && rem_bv == bv1);
+  bool alias2 = dst_bv == bv2 || (rem_bv != nullptr && rem_bv == bv2);
+  AlgWorkspace::Frame frame1{_workspace(), alias1 ? nc1 * nb : 0};
+  AlgWorkspace::Frame frame2{_workspace(), alias2 && bv1 != bv2 ? nc2 * nb : 0};
+  if ( alias2 && bv1 != bv2 ) {
+    copy(nc2, frame2.body(), 0, bv2, 0);
+    bv2 = frame2.body();
+  }
+  if ( alias1 ) {
+    bool same = bv1 == bv2;
+    copy(nc1, frame1.body(), 0, bv1, 0);
+    bv1 = frame1.body();
+    if ( same ) {
+      bv2 = bv1;
     }
-    dst_bv[wbase + blk] = tmp;
-    ++ wpos;
   }
-
-  return wpos;
+  dst_nc = _division(dst_bv, rem_bv, rem_nc, nc1, bv1, nc2, bv2, sig1, sig2);
+  mOpCache->put(op, h, nb, nc1, bv1, nc2, bv2,
+		dst_nc, dst_bv, rem_bv != nullptr ? rem_nc : 0, rem_bv);
+  return dst_nc;
 }
 
-// @brief カバーの代数的除算を行う．
+// @brief カバーの代数的除算を行い，剰余も求める．
 SizeType
-AlgMgr::division(
+AlgMgr::_division(
   ymuint64* dst_bv,
+  ymuint64* rem_bv,
+  SizeType& rem_nc,
   SizeType nc1,
   const ymuint64* bv1,
   SizeType nc2,
-  const ymuint64* bv2
+  const ymuint64* bv2,
+  const ymuint64* sig1,
+  const ymuint64* sig2
 )
 {
-  // 作業領域のビットベクタを確保する．
-  // 大きさは nc1
-  _resize_buff(nc1);
+  // weak division のアルゴリズム
+  //
+  // 除数の各キューブ d_j ごとに，d_j を含む被除数のキューブを
+  // d_j で割った商の集合 Q_j を求める．
+  // 答は Q_j の共通部分となる．
+  // - d_j を含むキューブの候補は被除数のキューブをリテラルごとの
+  //   バケツに分類しておいて，d_j のリテラルのうちで最も小さい
+  //   バケツから選ぶ．
+  // - Q_0 をハッシュ表に登録しておき，各商が何個の Q_j に現れたかを
+  //   数える．nc2 個の Q_j に現れた商が答となる．
+  // - 候補のキューブは d_j のシグネチャを含まなければ
+  //   cube_division() を呼ばずに除外する．
+  // - 剰余は答の商と d_j の積に含まれない被除数のキューブとなる．
+
+  if ( nc2 == 0 || nc1 < nc2 ) {
+    // 商は空となり，剰余は被除数そのものとなる．
+    if ( rem_bv != nullptr ) {
+      if ( rem_bv != bv1 ) {
+	copy(nc1, rem_bv, 0, bv1, 0);
+      }
+      rem_nc = nc1;
+    }
+    return 0;
+  }
 
-  // bv1 の各キューブは高々1つのキューブでしか割ることはできない．
-  // ただし，除数も被除数も algebraic expression の場合
-  // ので bv1 の各キューブについて bv2 の各キューブで割ってみて
-  // 成功した場合，その商を記録する．
-  vector<bool> mark(nc1, false);
-  for ( SizeType i = 0; i < nc1; ++ i ) {
-    for ( SizeType j = 0; j < nc2; ++ j ) {
-      if ( cube_division(mTmpBuff, i, bv1, i, bv2, j) ) {
-	mark[i] = true;
-	break;
+  SizeType nb = _cube_size();
+  // 被除数のキューブをリテラルごとのバケツに分類する．
+  // lit のバケツは bucket[start[lit]] 〜 bucket[start[lit + 1] - 1]
+  SizeType nl = variable_num() * 2;
+  AlgWorkspace::Frame start_frame{_workspace(), nl + 1};
+  ymuint64* start = start_frame.body();
+  for ( SizeType lit = 0; lit <= nl; ++ lit ) {
+    start[lit] = 0;
+  }
+  for ( SizeType i = 0; i < nc1 * nb; ++ i ) {
+    SizeType blk = i % nb;
+    for ( ymuint64 pat = bv1[i]; pat != 0ULL; pat &= pat - 1 ) {
+      SizeType bit = __builtin_ctzll(pat);
+      ++ start[_lit_index(blk, bit) + 1];
+    }
+  }
+  for ( SizeType lit = 0; lit < nl; ++ lit ) {
+    start[lit + 1] += start[lit];
+  }
+  AlgWorkspace::Frame bucket_frame{_workspace(), start[nl]};
+  ymuint64* bucket = bucket_frame.body();
+  {
+    AlgWorkspace::Frame wpos_frame{_workspace(), nl};
+    ymuint64* wpos = wpos_frame.body();
+    for ( SizeType lit = 0; lit < nl; ++ lit ) {
+      wpos[lit] = start[lit];
+    }
+    for ( SizeType i = 0; i < nc1 * nb; ++ i ) {
+      SizeType blk = i % nb;
+      for ( ymuint64 pat = bv1[i]; pat != 0ULL; pat &= pat - 1 ) {
+	SizeType bit = __builtin_ctzll(pat);
+	SizeType lit = _lit_index(blk, bit);
+	bucket[wpos[lit]] = i / nb;
+	++ wpos[lit];
       }
     }
   }
 
-  // 商のキューブは tmp 中に nc2 回現れているはず．
-  vector<SizeType> pos_list;
-  pos_list.reserve(nc1);
-  for ( SizeType i = 0; i < nc1; ++ i ) {
-    if ( !mark[i] ) {
-      // 対象ではない．
-      continue;
+  // 与えられていなければシグネチャを求める．
+  AlgWorkspace::Frame sig1_frame{_workspace(), sig1 == nullptr ? nc1 : 0};
+  if ( sig1 == nullptr ) {
+    _cube_signature(sig1_frame.body(), nc1, bv1, nb);
+    sig1 = sig1_frame.body();
+  }
+  AlgWorkspace::Frame sig2_frame{_workspace(), sig2 == nullptr ? nc2 : 0};
+  if ( sig2 == nullptr ) {
+    _cube_signature(sig2_frame.body(), nc2, bv2, nb);
+    sig2 = sig2_frame.body();
+  }
+
+  // 除数のサポートを求める．
+  // 商は除数と共通の変数を含んではいけない．
+  AlgWorkspace::Frame sup_frame{_workspace(), nb};
+  ymuint64* sup = sup_frame.body();
+  for ( SizeType k = 0; k < nb; ++ k ) {
+    ymuint64 tmp = 0ULL;
+    for ( SizeType j = 0; j < nc2; ++ j ) {
+      tmp |= bv2[j * nb + k];
+    }
+    tmp = (tmp | (tmp >> 1)) & 0x5555555555555555ULL;
+    sup[k] = tmp | (tmp << 1);
+  }
+
+  // 商の候補を入れるハッシュ表
+  SizeType qnum = 0;
+  SizeType hsize = _hash_size(nc1 * 2);
+  SizeType hmask = hsize - 1;
+  AlgWorkspace::Frame slot_frame{_workspace(), hsize};
+  ymuint64* slot = slot_frame.body();
+  for ( SizeType h = 0; h < hsize; ++ h ) {
+    slot[h] = kEmptySlot;
+  }
+  // 商の候補のキューブとその出現回数
+  AlgWorkspace::Frame qbv_frame{_workspace(), (nc1 + 1) * nb};
+  ymuint64* q_bv = qbv_frame.body();
+  AlgWorkspace::Frame qcount_frame{_workspace(), nc1};
+  ymuint64* q_count = qcount_frame.body();
+
+  SizeType check_num = 0;
+  SizeType reject_num = 0;
+  for ( SizeType j = 0; j < nc2; ++ j ) {
+    // d_j のリテラルのうち最も小さいバケツを探す．
+    const ymuint64* d_bv = bv2 + j * nb;
+    const ymuint64* cand = nullptr;
+    SizeType cand_num = nc1;
+    for ( SizeType k = 0; k < nb; ++ k ) {
+      for ( ymuint64 pat = d_bv[k]; pat != 0ULL; pat &= pat - 1 ) {
+	SizeType lit = _lit_index(k, __builtin_ctzll(pat));
+	SizeType n = start[lit + 1] - start[lit];
+	if ( cand == nullptr || n < cand_num ) {
+	  cand = bucket + start[lit];
+	  cand_num = n;
+	}
+      }
     }
 
-    SizeType c = 1;
-    vector<SizeType> tmp_list;
-    for ( SizeType i2 = i + 1; i2 < nc1; ++ i2 ) {
-      if ( mark[i2] && cube_compare(mTmpBuff, i, mTmpBuff, i2) == 0 ) {
-	++ c;
-	// i 番目のキューブと等しかったキューブ位置を記録する．
-	tmp_list.push_back(i2);
+    // 商の候補は q_bv の末尾(qnum 番目)で計算する．
+    SizeType hit_num = 0;
+    ymuint64 d_sig = sig2[j];
+    check_num += cand_num;
+    for ( SizeType c = 0; c < cand_num; ++ c ) {
+      SizeType i = cand != nullptr ? cand[c] : c;
+      if ( (d_sig & ~sig1[i]) != 0ULL ) {
+	++ reject_num;
+	continue;
+      }
+      if ( !cube_division(q_bv, qnum, bv1, i, bv2, j) ) {
+	continue;
+      }
+      if ( cube_check_intersect(q_bv, qnum, sup, 0) ) {
+	continue;
+      }
+      SizeType h = _cube_hash(q_bv, qnum) & hmask;
+      for ( ; slot[h] != kEmptySlot; h = (h + 1) & hmask ) {
+	if ( cube_compare(q_bv, slot[h], q_bv, qnum) == 0 ) {
+	  break;
+	}
+      }
+      if ( slot[h] == kEmptySlot ) {
+	if ( j == 0 ) {
+	  // Q_0 の要素を登録する．
+	  slot[h] = qnum;
+	  q_count[qnum] = 1;
+	  ++ qnum;
+	  ++ hit_num;
+	}
+      }
+      else if ( q_count[slot[h]] == j ) {
+	++ q_count[slot[h]];
+	++ hit_num;
       }
     }
-    if ( c == nc2 ) {
-      // 見つけた
-      pos_list.push_back(i);
-      // tmp_list に含まれるキューブはもう調べなくて良い．
-      for ( SizeType j = 0; j < tmp_list.size(); ++ j ) {
-	SizeType pos = tmp_list[j];
-	mark[pos] = false;
+    if ( hit_num == 0 ) {
+      // 共通部分が空になった．
+      qnum = 0;
+      break;
+    }
+  }
+  mSigCheckNum.fetch_add(check_num, std::memory_order_relaxed);
+  mSigRejectNum.fetch_add(reject_num, std::memory_order_relaxed);
+
+  // nc2 回現れた商のみを残す．
+  SizeType wpos = 0;
+  for ( SizeType e = 0; e < qnum; ++ e ) {
+    if ( q_count[e] == nc2 ) {
+      if ( wpos != e ) {
+	cube_copy(q_bv, wpos, q_bv, e);
       }
+      ++ wpos;
     }
   }
+  qnum = wpos;
 
-  SizeType nc = pos_list.size();
-  for ( SizeType i = 0; i < nc; ++ i ) {
-    SizeType pos = pos_list[i];
-    cube_copy(dst_bv, i, mTmpBuff, pos);
+  if ( rem_bv != nullptr ) {
+    // 被除数のキューブのハッシュ表を作る．
+    for ( SizeType h = 0; h < hsize; ++ h ) {
+      slot[h] = kEmptySlot;
+    }
+    for ( SizeType i = 0; i < nc1; ++ i ) {
+      SizeType h = _cube_hash(bv1, i) & hmask;
+      while ( slot[h] != kEmptySlot ) {
+	h = (h + 1) & hmask;
+      }
+      slot[h] = i;
+    }
+    // 商と除数の積に含まれるキューブに印をつける．
+    AlgWorkspace::Frame mark_frame{_workspace(), nc1};
+    ymuint64* mark = mark_frame.body();
+    for ( SizeType i = 0; i < nc1; ++ i ) {
+      mark[i] = 0;
+    }
+    for ( SizeType e = 0; e < qnum; ++ e ) {
+      for ( SizeType j = 0; j < nc2; ++ j ) {
+	cube_product(q_bv, qnum, q_bv, e, bv2, j);
+	SizeType h = _cube_hash(q_bv, qnum) & hmask;
+	for ( ; slot[h] != kEmptySlot; h = (h + 1) & hmask ) {
+	  if ( cube_compare(bv1, slot[h], q_bv, qnum) == 0 ) {
+	    mark[slot[h]] = 1;
+	    break;
+	  }
+	}
+      }
+    }
+    // 剰余は被除数の順に並ぶのでそのまま整列している．
+    rem_nc = 0;
+    for ( SizeType i = 0; i < nc1; ++ i ) {
+      if ( mark[i] == 0 ) {
+	if ( rem_bv != bv1 || rem_nc != i ) {
+	  cube_copy(rem_bv, rem_nc, bv1, i);
+	}
+	++ rem_nc;
+      }
+    }
   }
 
-  return nc;
+  // 商を dst_bv にコピーして整列する．
+  copy(qnum, dst_bv, 0, q_bv, 0);
+  return sort(qnum, dst_bv);
 }
 
 // @brief カバーをリテラルで割る．
@@ -589,6 +1304,12 @@ AlgMgr::common_cube(
 {
   SizeType nb = _cube_size();
 
+  if ( nc1 == 0 ) {
+    // 空のカバーの時は空のキューブとする．
+    cube_clear(dst_bv, 0);
+    return;
+  }
+
   // 最初のキューブをコピーする．
   cube_copy(dst_bv, 0, bv1, 0);
 
@@ -608,6 +1329,61 @@ AlgMgr::common_cube(
   }
 }
 
+// @brief カバーをビットプレーン形式に変換する．
+void
+AlgMgr::to_bitplane(
+  ymuint64* planes,
+  SizeType nc,
+  const ymuint64* bv
+)
+{
+  SizeType nb = _cube_size();
+  SizeType np = plane_size(nc);
+  SizeType n = variable_num() * 2 * np;
+  for ( SizeType i = 0; i < n; ++ i ) {
+    planes[i] = 0ULL;
+  }
+  // 立っているビットだけをたどるのでリテラル数に比例した時間で済む．
+  for ( SizeType i = 0; i < nc; ++ i, bv += nb ) {
+    SizeType w = i / 64;
+    ymuint64 b = 1ULL << (i % 64);
+    for ( SizeType blk = 0; blk < nb; ++ blk ) {
+      for ( ymuint64 pat = bv[blk]; pat != 0ULL; pat &= pat - 1 ) {
+	SizeType lit = _lit_index(blk, __builtin_ctzll(pat));
+	planes[lit * np + w] |= b;
+      }
+    }
+  }
+}
+
+// @brief ビットプレーン形式からカバーのビットベクタを作る．
+void
+AlgMgr::from_bitplane(
+  ymuint64* dst_bv,
+  SizeType nc,
+  const ymuint64* planes
+)
+{
+  SizeType nb = _cube_size();
+  for ( SizeType i = 0; i < nc; ++ i ) {
+    cube_clear(dst_bv, i);
+  }
+  SizeType np = plane_size(nc);
+  SizeType nl = variable_num() * 2;
+  for ( SizeType lit = 0; lit < nl; ++ lit, planes += np ) {
+    SizeType var_id = lit / 2;
+    SizeType blk = _block_pos(var_id);
+    ymuint64 pat = (lit & 1) == 0 ? kAlgPolP : kAlgPolN;
+    ymuint64 mask = pat << _shift_num(var_id);
+    for ( SizeType w = 0; w < np; ++ w ) {
+      for ( ymuint64 bits = planes[w]; bits != 0ULL; bits &= bits - 1 ) {
+	SizeType i = w * 64 + __builtin_ctzll(bits);
+	dst_bv[i * nb + blk] |= mask;
+      }
+    }
+  }
+}
+
 // @brief カバー(を表すビットベクタ)のコピーを行う．
 void
 AlgMgr::copy(
@@ -619,12 +1395,255 @@ AlgMgr::copy(
 )
 {
   SizeType nb = _cube_size();
-  ymuint64* dst = dst_bv + dst_pos * nb;
-  const ymuint64* src = src_bv + src_pos * nb;
-  const ymuint64* src_end = src + cube_num * nb;
-  for ( ; src != src_end; ++ src, ++ dst ) {
-    *dst = *src;
+  mCubeOps->copy(dst_bv + dst_pos * nb, src_bv + src_pos * nb,
+		 cube_num, nb);
+}
+
+BEGIN_NONAMESPACE
+
+// これより少ないキューブ数の時はその場でマージソートを行う．
+const SizeType kIndexSortMin = 32;
+
+// これ以上のキューブ数でキューブのワード数が kRadixMaxWords 以下の時
+// MSD radix sort を用いる．
+const SizeType kRadixSortMin = 256;
+const SizeType kRadixMaxWords = 2;
+
+// MSD radix sort でこれより少ない要素は比較による整列を行う．
+const SizeType kRadixCutoff = 32;
+
+END_NONAMESPACE
+
+// @brief カバー(を表すビットベクタ)を整列する．
+SizeType
+AlgMgr::sort(
+  SizeType cube_num,
+  ymuint64* bv
+)
+{
+  if ( cube_num < kIndexSortMin ) {
+    _sort(bv, 0, cube_num);
+    return _unique(cube_num, bv);
+  }
+
+  // キューブ番号の配列を整列する．
+  SizeType nb = _cube_size();
+  AlgWorkspace::Frame idx_frame{_workspace(), cube_num};
+  ymuint64* idx = idx_frame.body();
+  for ( SizeType i = 0; i < cube_num; ++ i ) {
+    idx[i] = i;
+  }
+  if ( cube_num >= kRadixSortMin && nb <= kRadixMaxWords ) {
+    AlgWorkspace::Frame tmp_frame{_workspace(), cube_num};
+    _radix_sort(bv, idx, tmp_frame.body(), cube_num, 0);
+  }
+  else {
+    _index_sort(bv, idx, cube_num);
+  }
+
+  // 整列した順にキューブを移動する．
+  // 重複したキューブはここで取り除く．
+  AlgWorkspace::Frame frame{_workspace(), cube_num * nb};
+  ymuint64* tmp_bv = frame.body();
+  SizeType wpos = 0;
+  for ( SizeType i = 0; i < cube_num; ++ i ) {
+    SizeType pos = idx[i];
+    if ( wpos > 0 && cube_compare(tmp_bv, wpos - 1, bv, pos) == 0 ) {
+      continue;
+    }
+    cube_copy(tmp_bv, wpos, bv, pos);
+    ++ wpos;
+  }
+  copy(wpos, bv, 0, tmp_bv, 0);
+  return wpos;
+}
+
+// @brief 他のキューブに含まれるキューブを取り除く．
+SizeType
+AlgMgr::scc_minimal(
+  SizeType cube_num,
+  ymuint64* bv,
+  ymuint64* sig
+)
+{
+  if ( cube_num <= 1 ) {
+    return cube_num;
+  }
+
+  // - キューブ c が d に含まれるのは d のリテラルが c のリテラルの
+  //   部分集合の時なので，d のリテラル数は c 以下となる．
+  //   そこでリテラル数の昇順に調べて，残すことにしたキューブとだけ
+  //   比較すればよい．
+  // - 各キューブのワードの OR をシグネチャとしておき，
+  //   sig(d) が sig(c) に含まれない組は cube_check_containment()
+  //   を呼ばずに除外する．
+  SizeType nb = _cube_size();
+  AlgWorkspace::Frame sig_frame{_workspace(), sig == nullptr ? cube_num : 0};
+  if ( sig == nullptr ) {
+    sig = sig_frame.body();
+    _cube_signature(sig, cube_num, bv, nb);
+  }
+  // キューブ番号は下位32ビットに詰めるのでキューブ数は 2^32 未満に限る．
+  ASSERT_COND( cube_num <= 0xFFFFFFFFULL );
+  AlgWorkspace::Frame key_frame{_workspace(), cube_num};
+  ymuint64* key = key_frame.body();
+  for ( SizeType i = 0; i < cube_num; ++ i ) {
+    // 上位にリテラル数，下位にキューブ番号を入れる．
+    key[i] = (static_cast<ymuint64>(literal_num(1, bv + i * nb)) << 32) | i;
+  }
+  std::sort(key, key + cube_num);
+
+  // kept[0] 〜 kept[kept_num - 1] が残すことにしたキューブ番号
+  AlgWorkspace::Frame kept_frame{_workspace(), cube_num};
+  ymuint64* kept = kept_frame.body();
+  SizeType kept_num = 0;
+  AlgWorkspace::Frame mark_frame{_workspace(), cube_num};
+  ymuint64* mark = mark_frame.body();
+  for ( SizeType i = 0; i < cube_num; ++ i ) {
+    mark[i] = 0;
+  }
+  SizeType check_num = 0;
+  SizeType reject_num = 0;
+  for ( SizeType k = 0; k < cube_num; ++ k ) {
+    SizeType i = key[k] & 0xFFFFFFFFULL;
+    ymuint64 nsig = ~sig[i];
+    bool contained = false;
+    for ( SizeType x = 0; x < kept_num; ++ x ) {
+      SizeType j = kept[x];
+      ++ check_num;
+      if ( (sig[j] & nsig) != 0ULL ) {
+	++ reject_num;
+	continue;
+      }
+      if ( cube_check_containment(bv, i, bv, j) ) {
+	contained = true;
+	break;
+      }
+    }
+    if ( !contained ) {
+      kept[kept_num] = i;
+      ++ kept_num;
+      mark[i] = 1;
+    }
+  }
+  mSigCheckNum.fetch_add(check_num, std::memory_order_relaxed);
+  mSigRejectNum.fetch_add(reject_num, std::memory_order_relaxed);
+
+  // 元の順序を保ったまま詰める．
+  SizeType wpos = 0;
+  for ( SizeType i = 0; i < cube_num; ++ i ) {
+    if ( mark[i] ) {
+      if ( wpos != i ) {
+	cube_copy(bv, wpos, bv, i);
+	sig[wpos] = sig[i];
+      }
+      ++ wpos;
+    }
+  }
+  return wpos;
+}
+
+// @brief キューブごとのシグネチャを求める．
+void
+AlgMgr::cube_signature(
+  ymuint64* sig,
+  SizeType nc,
+  const ymuint64* bv
+)
+{
+  _cube_signature(sig, nc, bv, _cube_size());
+}
+
+// @brief キューブ番号の配列を比較関数で整列する．
+void
+AlgMgr::_index_sort(
+  const ymuint64* bv,
+  ymuint64* idx,
+  SizeType n
+)
+{
+  std::sort(idx, idx + n,
+	    [this, bv](ymuint64 a, ymuint64 b) {
+	      return cube_compare(bv, a, bv, b) > 0;
+	    });
+}
+
+// @brief キューブ番号の配列を MSD radix sort で整列する．
+void
+AlgMgr::_radix_sort(
+  const ymuint64* bv,
+  ymuint64* idx,
+  ymuint64* tmp,
+  SizeType n,
+  SizeType byte_pos
+)
+{
+  SizeType nb = _cube_size();
+  if ( byte_pos == nb * 8 ) {
+    // すべてのバイトが等しい．
+    return;
+  }
+  if ( n < kRadixCutoff ) {
+    _index_sort(bv, idx, n);
+    return;
+  }
+
+  // 各キューブの byte_pos バイト目(ワードの上位から数える)で分類する．
+  SizeType blk = byte_pos / 8;
+  SizeType sft = (7 - (byte_pos % 8)) * 8;
+  SizeType count[256] = { 0 };
+  for ( SizeType i = 0; i < n; ++ i ) {
+    SizeType b = (bv[idx[i] * nb + blk] >> sft) & 0xFFULL;
+    ++ count[b];
+  }
+
+  // 降順に並べるので大きい値のバケツから詰めていく．
+  SizeType offset[256];
+  SizeType pos = 0;
+  for ( SizeType b = 256; b -- > 0; ) {
+    offset[b] = pos;
+    pos += count[b];
+  }
+  for ( SizeType i = 0; i < n; ++ i ) {
+    SizeType b = (bv[idx[i] * nb + blk] >> sft) & 0xFFULL;
+    tmp[offset[b]] = idx[i];
+    ++ offset[b];
   }
+  for ( SizeType i = 0; i < n; ++ i ) {
+    idx[i] = tmp[i];
+  }
+
+  // 各バケツを次のバイトで整列する．
+  pos = 0;
+  for ( SizeType b = 256; b -- > 0; ) {
+    SizeType c = count[b];
+    if ( c > 1 ) {
+      _radix_sort(bv, idx + pos, tmp, c, byte_pos + 1);
+    }
+    pos += c;
+  }
+}
+
+// @brief 整列したビットベクタから隣り合った重複を取り除く．
+SizeType
+AlgMgr::_unique(
+  SizeType cube_num,
+  ymuint64* bv
+)
+{
+  if ( cube_num == 0 ) {
+    return 0;
+  }
+  SizeType wpos = 1;
+  for ( SizeType rpos = 1; rpos < cube_num; ++ rpos ) {
+    if ( cube_compare(bv, wpos - 1, bv, rpos) != 0 ) {
+      if ( wpos != rpos ) {
+	cube_copy(bv, wpos, bv, rpos);
+      }
+      ++ wpos;
+    }
+  }
+  return wpos;
 }
 
 // @brief マージソートを行う下請け関数
@@ -645,7 +1664,6 @@ AlgMgr::_sort(
     SizeType pos1 = pos0 + 1;
     if ( cube_compare(bv, pos0, bv, pos1) < 0 ) {
       // (1, 0) だったので交換する．
-      _resize_buff(1);
       cube_swap(bv, pos0, bv, pos1);
     }
     return;
@@ -663,20 +1681,17 @@ AlgMgr::_sort(
 	if ( cube_compare(bv, pos1, bv, pos2) < 0 ) {
 	  // (2, 1, 0)
 	  // 0 と 2 を交換
-	  _resize_buff(1);
 	  cube_swap(bv, pos0, bv, pos2);
 	}
 	else {
 	  // (1, 2, 0)
 	  // 0 <- 1, 1 <- 2, 2 <- 0
-	  _resize_buff(1);
 	  cube_rotate3(bv, pos0, bv, pos1, bv, pos2);
 	}
       }
       else {
 	// (1, 0, 2)
 	// 0 <-> 1
-	_resize_buff(0);
 	cube_swap(bv, pos0, bv, pos1);
       }
     }
@@ -685,7 +1700,6 @@ AlgMgr::_sort(
       if ( cube_compare(bv, pos0, bv, pos2) < 0 ) {
 	// (2, 0, 1)
 	// 0 <- 2, 2 <- 1, 1 <- 0
-	_resize_buff(1);
 	cube_rotate3(bv, pos0, bv, pos2, bv, pos1);
       }
       else {
@@ -693,7 +1707,6 @@ AlgMgr::_sort(
 	if ( cube_compare(bv, pos1, bv, pos2) < 0 ) {
 	  // (0, 2, 1)
 	  // 1 <-> 2
-	  _resize_buff(1);
 	  cube_swap(bv, pos1, bv, pos2);
 	}
 	else {
@@ -709,7 +1722,6 @@ AlgMgr::_sort(
     SizeType pos1 = pos0 + 1;
     SizeType pos2 = pos1 + 1;
     SizeType pos3 = pos2 + 1;
-    _resize_buff(1);
     // 0 と 1 を整列
     if ( cube_compare(bv, pos0, bv, pos1) < 0 ) {
       cube_swap(bv, pos0, bv, pos1);
@@ -760,23 +1772,24 @@ AlgMgr::_sort(
   _sort(bv, start2, end2);
 
   // trivial case
-  // 前半部分の末尾が後半部分の先頭より大きければ
+  // 前半部分の末尾が後半部分の先頭以上ならば
   // すでに整列している．
-  if ( cube_compare(bv, end1 - 1, bv, start2) > 0 ) {
+  if ( cube_compare(bv, end1 - 1, bv, start2) >= 0 ) {
     return;
   }
 
   // マージする．
-  // 前半部分を一旦 mTmpBuff にコピーする．
-  _resize_buff(hn);
-  copy(hn, mTmpBuff, 0, bv, start1);
+  // 前半部分を一旦作業領域にコピーする．
+  AlgWorkspace::Frame frame{_workspace(), hn * _cube_size()};
+  ymuint64* tmp_bv = frame.body();
+  copy(hn, tmp_bv, 0, bv, start1);
   SizeType rpos1 = 0;
   SizeType rpos2 = start2;
   SizeType wpos = start1;
   while ( rpos1 < hn && rpos2 < end2 ) {
-    int comp_res = cube_compare(mTmpBuff, rpos1, bv, rpos2);
+    int comp_res = cube_compare(tmp_bv, rpos1, bv, rpos2);
     if ( comp_res > 0 ) {
-      cube_copy(bv, wpos, mTmpBuff, rpos1);
+      cube_copy(bv, wpos, tmp_bv, rpos1);
       ++ wpos;
       ++ rpos1;
     }
@@ -786,12 +1799,15 @@ AlgMgr::_sort(
       ++ rpos2;
     }
     else {
-      // 重複したキューブはエラー
-      ASSERT_NOT_REACHED;
+      // 重複したキューブは両方残しておく．
+      // sort() の最後に取り除かれる．
+      cube_copy(bv, wpos, tmp_bv, rpos1);
+      ++ wpos;
+      ++ rpos1;
     }
   }
   for ( ; rpos1 < hn; ++ rpos1, ++ wpos) {
-    cube_copy(bv, wpos, mTmpBuff, rpos1);
+    cube_copy(bv, wpos, tmp_bv, rpos1);
   }
   // 後半部分が残っている時はそのままでいいはず．
   ASSERT_COND( rpos2 == wpos );
@@ -832,20 +1848,47 @@ AlgMgr::hash(
   const ymuint64* bv
 )
 {
-  // キューブは常にソートされているので
-  // 順番は考慮する必要はない．
-  // ただおなじキューブの中のビットに関しては
-  // 本当は区別しなければならないがどうしようもないので
-  // 16ビットに区切って単純に XOR を取る．
+  return hash_append(kHashInit, nc, bv);
+}
+
+// @brief ハッシュ値にキューブを追加する．
+SizeType
+AlgMgr::hash_append(
+  SizeType h,
+  SizeType nc,
+  const ymuint64* bv
+)
+{
+  // wyhash と同様に 64x64->128 ビットの積の上位と下位の XOR で混ぜる．
+  // キューブは常にソートされているので順番に依存してよい．
+  // ワードごとに状態を更新するだけなので，キューブ単位で
+  // 分けて計算しても結果は変わらない．
   SizeType n = nc * _cube_size();
   const ymuint64* bv_end = bv + n;
-  SizeType ans = 0;
+  ymuint64 ans = h;
   for ( ; bv != bv_end; ++ bv ) {
-    ymuint64 pat = *bv;
-    ans ^= (pat & 0xFFFFULL); pat >>= 16;
-    ans ^= (pat & 0xFFFFULL); pat >>= 16;
-    ans ^= (pat & 0xFFFFULL); pat >>= 16;
-    ans ^= pat;
+    ans = _hash_mix(ans ^ *bv);
+  }
+  return ans;
+}
+
+// @brief キューブのハッシュ値を求める．
+SizeType
+AlgMgr::_cube_hash(
+  const ymuint64* bv,
+  SizeType pos
+)
+{
+  // hash() と異なりハッシュ表のインデックスとして使うので
+  // 下位ビットにまで十分に混ぜる．
+  SizeType nb = _cube_size();
+  const ymuint64* _bv = bv + pos * nb;
+  const ymuint64* _bv_end = _bv + nb;
+  ymuint64 ans = 0x9E3779B97F4A7C15ULL;
+  for ( ; _bv != _bv_end; ++ _bv ) {
+    ans ^= *_bv;
+    ans *= 0xBF58476D1CE4E5B9ULL;
+    ans ^= ans >> 31;
   }
   return ans;
 }
@@ -860,20 +1903,7 @@ AlgMgr::cube_compare(
 )
 {
   SizeType nb = _cube_size();
-  const ymuint64* _bv1 = bv1 + pos1 * nb;
-  const ymuint64* _bv2 = bv2 + pos2 * nb;
-  const ymuint64* _bv1_end = _bv1 + nb;
-  for ( ; _bv1 != _bv1_end; ++ _bv1, ++ _bv2 ) {
-    ymuint64 pat1 = *_bv1;
-    ymuint64 pat2 = *_bv2;
-    if ( pat1 < pat2 ) {
-      return -1;
-    }
-    else if ( pat1 > pat2 ) {
-      return 1;
-    }
-  }
-  return 0;
+  return mCubeOps->compare(bv1 + pos1 * nb, bv2 + pos2 * nb, nb);
 }
 
 // @brief 2つのキューブの積が空でない時 true を返す．
@@ -886,21 +1916,7 @@ AlgMgr::cube_check_product(
 )
 {
   SizeType nb = _cube_size();
-  const ymuint64* _bv1 = bv1 + pos1 * nb;
-  const ymuint64* _bv2 = bv2 + pos2 * nb;
-  const ymuint64* _bv1_end = _bv1 + nb;
-  for ( ; _bv1 != _bv1_end; ++ _bv1, ++ _bv2 ) {
-    ymuint64 tmp = *_bv1 | *_bv2;
-    ymuint64 mask1 = 0x5555555555555555ULL;
-    ymuint64 mask2 = 0xAAAAAAAAAAAAAAAAULL;
-    ymuint64 tmp1 = tmp & mask1;
-    ymuint64 tmp2 = tmp & mask2;
-    if ( (tmp1 & (tmp2 >> 1)) != 0ULL ) {
-      // 同じ変数の異なる極性のリテラルがあった．
-      return false;
-    }
-  }
-  return true;
+  return mCubeOps->check_product(bv1 + pos1 * nb, bv2 + pos2 * nb, nb);
 }
 
 // @brief 一方のキューブが他方のキューブに含まれているか調べる．
@@ -913,15 +1929,7 @@ AlgMgr::cube_check_containment(
 )
 {
   SizeType nb = _cube_size();
-  const ymuint64* _bv1 = bv1 + pos1 * nb;
-  const ymuint64* _bv2 = bv2 + pos2 * nb;
-  const ymuint64* _bv1_end = _bv1 + nb;
-  for ( ; _bv1 != _bv1_end; ++ _bv1, ++ _bv2 ) {
-    if ( (~(*_bv1) & *_bv2) != 0ULL ) {
-      return false;
-    }
-  }
-  return true;
+  return mCubeOps->check_containment(bv1 + pos1 * nb, bv2 + pos2 * nb, nb);
 }
 
 // @brief ２つのキューブに共通なリテラルがあれば true を返す．
@@ -934,15 +1942,7 @@ AlgMgr::cube_check_intersect(
 )
 {
   SizeType nb = _cube_size();
-  const ymuint64* _bv1 = bv1 + pos1 * nb;
-  const ymuint64* _bv2 = bv2 + pos2 * nb;
-  const ymuint64* _bv1_end = _bv1 + nb;
-  for ( ; _bv1 != _bv1_end; ++ _bv1, ++ _bv2 ) {
-    if ( (*_bv1 & *_bv2) != 0ULL ) {
-      return true;
-    }
-  }
-  return false;
+  return mCubeOps->check_intersect(bv1 + pos1 * nb, bv2 + pos2 * nb, nb);
 }
 
 // @brief キューブ(を表すビットベクタ)をクリアする．
@@ -953,11 +1953,67 @@ AlgMgr::cube_clear(
 )
 {
   SizeType nb = _cube_size();
-  ymuint64* dst = dst_bv + dst_pos * nb;
-  ymuint64* dst_end = dst + nb;
-  for ( ; dst != dst_end; ++ dst ) {
-    *dst = 0ULL;
-  }
+  mCubeOps->clear(dst_bv + dst_pos * nb, nb);
+}
+
+// @brief 2つのキューブ(を表すビットベクタ)を入れ替える．
+void
+AlgMgr::cube_swap(
+  ymuint64* bv1,
+  SizeType pos1,
+  ymuint64* bv2,
+  SizeType pos2
+)
+{
+  // 作業領域を介して移動する．
+  AlgWorkspace::Frame frame{_workspace(), _cube_size()};
+  ymuint64* tmp_bv = frame.body();
+  cube_copy(tmp_bv, 0, bv1, pos1);
+  cube_copy(bv1, pos1, bv2, pos2);
+  cube_copy(bv2, pos2, tmp_bv, 0);
+}
+
+// @brief 3つのキューブ(を表すビットベクタ)を入れ替える．
+void
+AlgMgr::cube_rotate3(
+  ymuint64* bv1,
+  SizeType pos1,
+  ymuint64* bv2,
+  SizeType pos2,
+  ymuint64* bv3,
+  SizeType pos3
+)
+{
+  // 作業領域を介して移動する．
+  AlgWorkspace::Frame frame{_workspace(), _cube_size()};
+  ymuint64* tmp_bv = frame.body();
+  cube_copy(tmp_bv, 0, bv1, pos1);
+  cube_copy(bv1, pos1, bv2, pos2);
+  cube_copy(bv2, pos2, bv3, pos3);
+  cube_copy(bv3, pos3, tmp_bv, 0);
+}
+
+// @brief 4つのキューブ(を表すビットベクタ)を入れ替える．
+void
+AlgMgr::cube_rotate4(
+  ymuint64* bv1,
+  SizeType pos1,
+  ymuint64* bv2,
+  SizeType pos2,
+  ymuint64* bv3,
+  SizeType pos3,
+  ymuint64* bv4,
+  SizeType pos4
+)
+{
+  // 作業領域を介して移動する．
+  AlgWorkspace::Frame frame{_workspace(), _cube_size()};
+  ymuint64* tmp_bv = frame.body();
+  cube_copy(tmp_bv, 0, bv1, pos1);
+  cube_copy(bv1, pos1, bv2, pos2);
+  cube_copy(bv2, pos2, bv3, pos3);
+  cube_copy(bv3, pos3, bv4, pos4);
+  cube_copy(bv4, pos4, tmp_bv, 0);
 }
 
 // @brief 2つのキューブの積を計算する．
@@ -972,23 +2028,8 @@ AlgMgr::cube_product(
 )
 {
   SizeType nb = _cube_size();
-  ymuint64* dst = dst_bv + dst_pos * nb;
-  const ymuint64* _bv1 = bv1 + pos1 * nb;
-  const ymuint64* _bv2 = bv2 + pos2 * nb;
-  const ymuint64* _bv1_end = _bv1 + nb;
-  for ( ; _bv1 != _bv1_end; ++ dst, ++ _bv1, ++ _bv2 ) {
-    ymuint64 tmp = *_bv1 | *_bv2;
-    ymuint64 mask1 = 0x5555555555555555ULL;
-    ymuint64 mask2 = 0xAAAAAAAAAAAAAAAAULL;
-    ymuint64 tmp1 = tmp & mask1;
-    ymuint64 tmp2 = tmp & mask2;
-    if ( (tmp1 & (tmp2 >> 1)) != 0ULL ) {
-      // 同じ変数の異なる極性のリテラルがあった．
-      return false;
-    }
-    *dst = tmp;
-  }
-  return true;
+  return mCubeOps->product(dst_bv + dst_pos * nb,
+			   bv1 + pos1 * nb, bv2 + pos2 * nb, nb);
 }
 
 // @brief キューブによる商を求める．
@@ -1003,18 +2044,8 @@ AlgMgr::cube_division(
 )
 {
   SizeType nb = _cube_size();
-  ymuint64* dst = dst_bv + dst_pos * nb;
-  const ymuint64* _bv1 = bv1 + pos1 * nb;
-  const ymuint64* _bv2 = bv2 + pos2 * nb;
-  const ymuint64* _bv1_end = _bv1 + nb;
-  for ( ; _bv1 != _bv1_end; ++ dst, ++ _bv1, ++ _bv2 ) {
-    if ( (~(*_bv1) & *_bv2) != 0ULL ) {
-      // この場合の dst の値は不定
-      return false;
-    }
-    *dst = *_bv1 & ~(*_bv2);
-  }
-  return true;
+  return mCubeOps->division(dst_bv + dst_pos * nb,
+			    bv1 + pos1 * nb, bv2 + pos2 * nb, nb);
 }
 
 // @brief 要素のチェック
@@ -1080,30 +2111,4 @@ AlgMgr::print(
   }
 }
 
-// @brief mTmpBuff を初期化する．
-void
-AlgMgr::_init_buff()
-{
-  // とりあえず 128 を初期値とする．
-  mTmpBuffSize = 128;
-  mTmpBuff = new_body(mTmpBuffSize);
-}
-
-// @brief mTmpBuff に必要な領域を確保する．
-void
-AlgMgr::_resize_buff(
-  SizeType req_size
-)
-{
-  SizeType old_size = mTmpBuffSize;
-  while ( mTmpBuffSize < req_size ) {
-    mTmpBuffSize <<= 1;
-  }
-
-  if ( old_size < mTmpBuffSize ) {
-    delete_body(mTmpBuff, old_size);
-  }
-  mTmpBuff = new_body(mTmpBuffSize);
-}
-
 END_NAMESPACE_YM_BFO
@@ -0,0 +1,195 @@
+
+/// @file AlgOpCache.cc
+/// @brief AlgOpCache の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "AlgOpCache.h"
+#include <algorithm>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+// クラス AlgOpCache
+//////////////////////////////////////////////////////////////////////
+
+// @brief 結果を探す．
+bool
+AlgOpCache::get(
+  Op op,
+  SizeType hash,
+  SizeType nb,
+  SizeType nc1,
+  const ymuint64* bv1,
+  SizeType nc2,
+  const ymuint64* bv2,
+  ymuint64* dst_bv,
+  SizeType& dst_nc,
+  ymuint64* rem_bv,
+  SizeType& rem_nc
+)
+{
+  std::lock_guard<std::mutex> lock{mMutex};
+  auto entry = _find(op, hash, nb, nc1, bv1, nc2, bv2);
+  if ( entry == nullptr ) {
+    ++ mStats.miss_num;
+    return false;
+  }
+
+  ++ mStats.hit_num;
+  entry->mRef = true;
+  const ymuint64* src = entry->mBody.data() + (nc1 + nc2) * nb;
+  dst_nc = entry->mDstNc;
+  std::copy(src, src + dst_nc * nb, dst_bv);
+  if ( op == kDivRem ) {
+    src += dst_nc * nb;
+    rem_nc = entry->mRemNc;
+    std::copy(src, src + rem_nc * nb, rem_bv);
+  }
+  return true;
+}
+
+// @brief 結果を登録する．
+void
+AlgOpCache::put(
+  Op op,
+  SizeType hash,
+  SizeType nb,
+  SizeType nc1,
+  const ymuint64* bv1,
+  SizeType nc2,
+  const ymuint64* bv2,
+  SizeType dst_nc,
+  const ymuint64* dst_bv,
+  SizeType rem_nc,
+  const ymuint64* rem_bv
+)
+{
+  if ( op != kDivRem ) {
+    rem_nc = 0;
+  }
+  SizeType size = (nc1 + nc2 + dst_nc + rem_nc) * nb;
+  if ( size + kEntryOverhead > mLimitWords ) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock{mMutex};
+  if ( _find(op, hash, nb, nc1, bv1, nc2, bv2) != nullptr ) {
+    // 他のスレッドが先に登録した．
+    return;
+  }
+  while ( mStats.used_words + size + kEntryOverhead > mLimitWords ) {
+    _evict();
+  }
+
+  SizeType id;
+  if ( mFreeList.empty() ) {
+    id = mEntryArray.size();
+    mEntryArray.push_back(Entry{});
+  }
+  else {
+    id = mFreeList.back();
+    mFreeList.pop_back();
+  }
+  auto& entry = mEntryArray[id];
+  entry.mOp = op;
+  entry.mHash = hash;
+  entry.mNc1 = nc1;
+  entry.mNc2 = nc2;
+  entry.mDstNc = dst_nc;
+  entry.mRemNc = rem_nc;
+  entry.mBody.resize(size);
+  auto dst = entry.mBody.data();
+  dst = std::copy(bv1, bv1 + nc1 * nb, dst);
+  dst = std::copy(bv2, bv2 + nc2 * nb, dst);
+  dst = std::copy(dst_bv, dst_bv + dst_nc * nb, dst);
+  std::copy(rem_bv, rem_bv + rem_nc * nb, dst);
+  entry.mRef = false;
+  entry.mValid = true;
+  mTable.emplace(hash, id);
+  ++ mStats.entry_num;
+  mStats.used_words += _entry_words(entry);
+}
+
+// @brief 統計情報を返す．
+AlgOpCacheStats
+AlgOpCache::stats() const
+{
+  std::lock_guard<std::mutex> lock{mMutex};
+  auto ans = mStats;
+  ans.limit_words = mLimitWords;
+  return ans;
+}
+
+// @brief 一致するエントリを探す．
+AlgOpCache::Entry*
+AlgOpCache::_find(
+  Op op,
+  SizeType hash,
+  SizeType nb,
+  SizeType nc1,
+  const ymuint64* bv1,
+  SizeType nc2,
+  const ymuint64* bv2
+)
+{
+  auto range = mTable.equal_range(hash);
+  for ( auto p = range.first; p != range.second; ++ p ) {
+    auto& entry = mEntryArray[p->second];
+    if ( entry.mOp != op || entry.mNc1 != nc1 || entry.mNc2 != nc2 ) {
+      continue;
+    }
+    // ハッシュ値の衝突に備えて被演算子の内容を比べる．
+    const ymuint64* body = entry.mBody.data();
+    if ( std::equal(bv1, bv1 + nc1 * nb, body) &&
+	 std::equal(bv2, bv2 + nc2 * nb, body + nc1 * nb) ) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+// @brief clock 法でエントリを1つ追い出す．
+void
+AlgOpCache::_evict()
+{
+  ASSERT_COND( mStats.entry_num > 0 );
+
+  // 参照フラグが立っていれば下ろして次に進む．
+  // 1周すれば必ず参照フラグの立っていないエントリが見つかる．
+  SizeType n = mEntryArray.size();
+  for ( ; ; mHand = (mHand + 1) % n ) {
+    auto& entry = mEntryArray[mHand];
+    if ( !entry.mValid ) {
+      continue;
+    }
+    if ( entry.mRef ) {
+      entry.mRef = false;
+      continue;
+    }
+    break;
+  }
+
+  SizeType id = mHand;
+  mHand = (mHand + 1) % n;
+  auto& entry = mEntryArray[id];
+  auto range = mTable.equal_range(entry.mHash);
+  for ( auto p = range.first; p != range.second; ++ p ) {
+    if ( p->second == id ) {
+      mTable.erase(p);
+      break;
+    }
+  }
+  mStats.used_words -= _entry_words(entry);
+  -- mStats.entry_num;
+  ++ mStats.evict_num;
+  entry.mValid = false;
+  entry.mBody = vector<ymuint64>{};
+  mFreeList.push_back(id);
+}
+
+END_NAMESPACE_YM_BFO
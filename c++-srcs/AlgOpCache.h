@@ -0,0 +1,212 @@
+#ifndef ALGOPCACHE_H
+#define ALGOPCACHE_H
+
+/// @file AlgOpCache.h
+/// @brief AlgOpCache のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/bfo_nsdef.h"
+#include "ym/AlgMgr.h"
+#include <mutex>
+#include <unordered_map>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgOpCache AlgOpCache.h "AlgOpCache.h"
+/// @brief AlgMgr のカバー演算の結果を記憶するキャッシュ
+///
+/// 演算の種類と2つの被演算子のハッシュ値をキーとし，
+/// 被演算子の内容そのものも記憶しておいて一致を確かめる．<br>
+/// 被演算子と結果の総ワード数(とエントリごとの固定分)が上限を
+/// 超えないように clock 法でエントリを追い出す．<br>
+/// get()/put()/stats() は内部で排他制御を行うので複数のスレッドから
+/// 同時に呼んでもよい．
+//////////////////////////////////////////////////////////////////////
+class AlgOpCache
+{
+public:
+
+  /// @brief 演算の種類
+  enum Op {
+    /// @brief 積
+    kProduct,
+    /// @brief 商
+    kDivision,
+    /// @brief 商と剰余
+    kDivRem
+  };
+
+  /// @brief コンストラクタ
+  explicit
+  AlgOpCache(
+    SizeType limit_words ///< [in] 使用できるワード数の上限
+  ) : mLimitWords{limit_words}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~AlgOpCache() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 結果を探す．
+  /// @return 見つかったら true を返す．
+  ///
+  /// 見つかった場合は dst_bv と(kDivRem の場合は) rem_bv に
+  /// 結果をコピーする．
+  bool
+  get(
+    Op op,               ///< [in] 演算の種類
+    SizeType hash,       ///< [in] 被演算子から求めたハッシュ値
+    SizeType nb,         ///< [in] 1キューブ分のワード数
+    SizeType nc1,        ///< [in] 1つめのカバーのキューブ数
+    const ymuint64* bv1, ///< [in] 1つめのカバーを表すビットベクタ
+    SizeType nc2,        ///< [in] 2つめのカバーのキューブ数
+    const ymuint64* bv2, ///< [in] 2つめのカバーを表すビットベクタ
+    ymuint64* dst_bv,    ///< [in] 結果を格納するビットベクタ
+    SizeType& dst_nc,    ///< [out] 結果のキューブ数
+    ymuint64* rem_bv,    ///< [in] 剰余を格納するビットベクタ
+    SizeType& rem_nc     ///< [out] 剰余のキューブ数
+  );
+
+  /// @brief 結果を登録する．
+  ///
+  /// 大きすぎて上限に収まらない場合は登録しない．
+  void
+  put(
+    Op op,                  ///< [in] 演算の種類
+    SizeType hash,          ///< [in] 被演算子から求めたハッシュ値
+    SizeType nb,            ///< [in] 1キューブ分のワード数
+    SizeType nc1,           ///< [in] 1つめのカバーのキューブ数
+    const ymuint64* bv1,    ///< [in] 1つめのカバーを表すビットベクタ
+    SizeType nc2,           ///< [in] 2つめのカバーのキューブ数
+    const ymuint64* bv2,    ///< [in] 2つめのカバーを表すビットベクタ
+    SizeType dst_nc,        ///< [in] 結果のキューブ数
+    const ymuint64* dst_bv, ///< [in] 結果を表すビットベクタ
+    SizeType rem_nc,        ///< [in] 剰余のキューブ数
+    const ymuint64* rem_bv  ///< [in] 剰余を表すビットベクタ
+  );
+
+  /// @brief 統計情報を返す．
+  AlgOpCacheStats
+  stats() const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  // エントリ
+  struct Entry
+  {
+    // 演算の種類
+    Op mOp;
+
+    // ハッシュ値
+    SizeType mHash;
+
+    // 1つめの被演算子のキューブ数
+    SizeType mNc1;
+
+    // 2つめの被演算子のキューブ数
+    SizeType mNc2;
+
+    // 結果のキューブ数
+    SizeType mDstNc;
+
+    // 剰余のキューブ数
+    SizeType mRemNc;
+
+    // 被演算子，結果，剰余の順に並べた本体
+    vector<ymuint64> mBody;
+
+    // 最近参照された時 true にするフラグ
+    bool mRef;
+
+    // 使用中の時 true にするフラグ
+    bool mValid;
+  };
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 一致するエントリを探す．
+  /// @return 見つからなければ nullptr を返す．
+  ///
+  /// mMutex を獲得した状態で呼ぶこと．
+  Entry*
+  _find(
+    Op op,               ///< [in] 演算の種類
+    SizeType hash,       ///< [in] 被演算子から求めたハッシュ値
+    SizeType nb,         ///< [in] 1キューブ分のワード数
+    SizeType nc1,        ///< [in] 1つめのカバーのキューブ数
+    const ymuint64* bv1, ///< [in] 1つめのカバーを表すビットベクタ
+    SizeType nc2,        ///< [in] 2つめのカバーのキューブ数
+    const ymuint64* bv2  ///< [in] 2つめのカバーを表すビットベクタ
+  );
+
+  /// @brief clock 法でエントリを1つ追い出す．
+  ///
+  /// mMutex を獲得した状態で呼ぶこと．
+  void
+  _evict();
+
+  /// @brief エントリの使用するワード数を返す．
+  static
+  SizeType
+  _entry_words(
+    const Entry& entry ///< [in] 対象のエントリ
+  )
+  {
+    return entry.mBody.size() + kEntryOverhead;
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 使用できるワード数の上限
+  SizeType mLimitWords;
+
+  // 以下のメンバを保護するミューテックス
+  mutable std::mutex mMutex;
+
+  // エントリの配列
+  vector<Entry> mEntryArray;
+
+  // 空いているエントリ番号のリスト
+  vector<SizeType> mFreeList;
+
+  // ハッシュ値からエントリ番号を引く表
+  std::unordered_multimap<SizeType, SizeType> mTable;
+
+  // clock 法の針の位置
+  SizeType mHand{0};
+
+  // 統計情報
+  AlgOpCacheStats mStats;
+
+  // エントリごとの固定分のワード数
+  static
+  constexpr SizeType kEntryOverhead = 16;
+
+};
+
+END_NAMESPACE_YM_BFO
+
+#endif // ALGOPCACHE_H
@@ -0,0 +1,336 @@
+
+/// @file AlgPlaReader.cc
+/// @brief AlgPlaReader の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/AlgPlaReader.h"
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+BEGIN_NONAMESPACE
+
+// 文字列を空白で区切る．
+vector<string>
+_split(
+  const string& str
+)
+{
+  vector<string> ans;
+  std::istringstream s{str};
+  string token;
+  while ( s >> token ) {
+    ans.push_back(token);
+  }
+  return ans;
+}
+
+// 文字列を数値に変換する．
+bool
+_to_num(
+  const string& str,
+  SizeType& num
+)
+{
+  if ( str.empty() ) {
+    return false;
+  }
+  char* end;
+  num = strtoul(str.c_str(), &end, 10);
+  return *end == '\0';
+}
+
+END_NONAMESPACE
+
+//////////////////////////////////////////////////////////////////////
+// クラス AlgPlaReader
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+AlgPlaReader::AlgPlaReader()
+{
+}
+
+// @brief デストラクタ
+AlgPlaReader::~AlgPlaReader()
+{
+  _clear();
+}
+
+// @brief ファイルを読み込む．
+bool
+AlgPlaReader::read(
+  const string& filename
+)
+{
+  std::ifstream s{filename};
+  if ( !s ) {
+    _clear();
+    return _error(filename + ": No such file");
+  }
+  return read(s);
+}
+
+// @brief ストリームから読み込む．
+bool
+AlgPlaReader::read(
+  istream& s
+)
+{
+  _clear();
+
+  bool ok = true;
+  string line;
+  while ( ok && getline(s, line) ) {
+    ++ mLineNo;
+    const char* str = line.c_str();
+    while ( isspace(static_cast<unsigned char>(*str)) ) {
+      ++ str;
+    }
+    if ( *str == '\0' || *str == '#' ) {
+      // 空行とコメント行は読み飛ばす．
+      continue;
+    }
+    if ( *str == '.' ) {
+      auto token_list = _split(line);
+      if ( token_list[0] == ".e" || token_list[0] == ".end" ) {
+	break;
+      }
+      ok = _read_command(token_list);
+    }
+    else {
+      ok = (mMgr != nullptr || _init()) && _read_cube(str);
+    }
+  }
+  if ( ok && mMgr == nullptr ) {
+    // キューブが1つもなかった．
+    ok = _init();
+  }
+  if ( !ok ) {
+    string msg = mErrorMessage;
+    _clear();
+    mErrorMessage = msg;
+    return false;
+  }
+
+  // 読み込んだ本体をカバーにする．
+  mCoverList.reserve(mBodyList.size());
+  for ( auto& body: mBodyList ) {
+    SizeType nc = mMgr->sort(body.mCubeNum, body.mBody);
+    mCoverList.push_back(AlgCover{*mMgr, nc, body.mCubeCap, body.mBody});
+  }
+  mBodyList.clear();
+
+  return true;
+}
+
+// @brief 読み込み結果をクリアする．
+void
+AlgPlaReader::_clear()
+{
+  mCoverList.clear();
+  for ( auto& body: mBodyList ) {
+    mMgr->delete_body(body.mBody, body.mCubeCap);
+  }
+  mBodyList.clear();
+  mMgr.reset();
+  mInputNum = 0;
+  mOutputNum = 0;
+  mCubeNumHint = 0;
+  mInputNameList.clear();
+  mOutputNameList.clear();
+  mLineNo = 0;
+  mErrorMessage = string{};
+}
+
+// @brief ドットで始まる行を処理する．
+bool
+AlgPlaReader::_read_command(
+  const vector<string>& token_list
+)
+{
+  const string& cmd = token_list[0];
+  if ( mMgr != nullptr && (cmd == ".i" || cmd == ".o" || cmd == ".ilb") ) {
+    // 最初のキューブで入出力数が確定しているので変更できない．
+    return _error(".i/.o/.ilb after the first cube");
+  }
+  if ( cmd == ".i" || cmd == ".o" || cmd == ".p" ) {
+    SizeType num;
+    if ( token_list.size() != 2 || !_to_num(token_list[1], num) ) {
+      return _error("syntax error in " + cmd);
+    }
+    if ( cmd == ".i" ) {
+      mInputNum = num;
+    }
+    else if ( cmd == ".o" ) {
+      mOutputNum = num;
+    }
+    else {
+      mCubeNumHint = num;
+    }
+  }
+  else if ( cmd == ".ilb" ) {
+    mInputNameList.assign(token_list.begin() + 1, token_list.end());
+  }
+  else if ( cmd == ".ob" ) {
+    mOutputNameList.assign(token_list.begin() + 1, token_list.end());
+  }
+  else if ( cmd == ".type" ) {
+    if ( token_list.size() != 2 ||
+	 (token_list[1] != "f" && token_list[1] != "fd") ) {
+      return _error("unsupported .type");
+    }
+  }
+  // それ以外のコマンドは無視する．
+  return true;
+}
+
+// @brief キューブを表す行を処理する．
+bool
+AlgPlaReader::_read_cube(
+  const char* str
+)
+{
+  SizeType nb = mMgr->cube_size();
+  for ( SizeType i = 0; i < nb; ++ i ) {
+    mInputPat[i] = 0ULL;
+  }
+
+  // 入力部
+  SizeType pos = 0;
+  for ( ; pos < mInputNum; ++ str ) {
+    char c = *str;
+    if ( c == '\0' ) {
+      return _error("too few inputs");
+    }
+    if ( isspace(static_cast<unsigned char>(c)) || c == '|' ) {
+      continue;
+    }
+    switch ( c ) {
+    case '0':
+      mMgr->set_literal(mInputPat.data(), 0, pos, kAlgPolN);
+      break;
+    case '1':
+      mMgr->set_literal(mInputPat.data(), 0, pos, kAlgPolP);
+      break;
+    case '-':
+    case '2':
+    case '~':
+      break;
+    default:
+      return _error(string{"illegal character '"} + c + "' in input part");
+    }
+    ++ pos;
+  }
+
+  // 出力部
+  pos = 0;
+  for ( ; *str != '\0'; ++ str ) {
+    char c = *str;
+    if ( isspace(static_cast<unsigned char>(c)) || c == '|' ) {
+      continue;
+    }
+    if ( pos == mOutputNum ) {
+      return _error("too many outputs");
+    }
+    switch ( c ) {
+    case '1':
+    case '4':
+      {
+	auto& body = mBodyList[pos];
+	SizeType cpos = _new_cube(body);
+	mMgr->cube_copy(body.mBody, cpos, mInputPat.data(), 0);
+      }
+      break;
+    case '0':
+    case '-':
+    case '2':
+    case '~':
+    case '3':
+      break;
+    default:
+      return _error(string{"illegal character '"} + c + "' in output part");
+    }
+    ++ pos;
+  }
+  if ( pos < mOutputNum ) {
+    return _error("too few outputs");
+  }
+  return true;
+}
+
+// @brief マネージャと本体の領域を用意する．
+bool
+AlgPlaReader::_init()
+{
+  if ( mInputNum == 0 ) {
+    return _error(".i is missing");
+  }
+  if ( mOutputNum == 0 ) {
+    return _error(".o is missing");
+  }
+  if ( mInputNameList.empty() ) {
+    mMgr.reset(new AlgMgr{mInputNum});
+  }
+  else {
+    if ( mInputNameList.size() != mInputNum ) {
+      return _error(".ilb does not match .i");
+    }
+    mMgr.reset(new AlgMgr{mInputNameList});
+  }
+  if ( !mOutputNameList.empty() && mOutputNameList.size() != mOutputNum ) {
+    return _error(".ob does not match .o");
+  }
+
+  // 多出力の場合は各出力が平均的にキューブを持つと仮定する．
+  SizeType cap = AlgCover::get_capacity(mCubeNumHint / mOutputNum);
+  mBodyList.reserve(mOutputNum);
+  for ( SizeType i = 0; i < mOutputNum; ++ i ) {
+    mBodyList.push_back(Body{mMgr->new_body(cap), 0, cap});
+  }
+  mInputPat.resize(mMgr->cube_size());
+  return true;
+}
+
+// @brief 本体に1キューブ分の領域を確保する．
+SizeType
+AlgPlaReader::_new_cube(
+  Body& body
+)
+{
+  if ( body.mCubeNum == body.mCubeCap ) {
+    SizeType new_cap = body.mCubeCap * 2;
+    ymuint64* new_body = mMgr->new_body(new_cap);
+    mMgr->copy(body.mCubeNum, new_body, 0, body.mBody, 0);
+    mMgr->delete_body(body.mBody, body.mCubeCap);
+    body.mBody = new_body;
+    body.mCubeCap = new_cap;
+  }
+  SizeType pos = body.mCubeNum;
+  ++ body.mCubeNum;
+  return pos;
+}
+
+// @brief エラーメッセージをセットする．
+bool
+AlgPlaReader::_error(
+  const string& msg
+)
+{
+  std::ostringstream buf;
+  if ( mLineNo > 0 ) {
+    buf << "line " << mLineNo << ": ";
+  }
+  buf << msg;
+  mErrorMessage = buf.str();
+  return false;
+}
+
+END_NAMESPACE_YM_BFO
@@ -0,0 +1,106 @@
+
+/// @file AlgPlaWriter.cc
+/// @brief AlgPlaWriter の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/AlgPlaWriter.h"
+#include "ym/AlgMgr.h"
+#include <fstream>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+// クラス AlgPlaWriter
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+AlgPlaWriter::AlgPlaWriter(
+  const vector<string>& output_name_list
+) : mOutputNameList{output_name_list}
+{
+}
+
+// @brief デストラクタ
+AlgPlaWriter::~AlgPlaWriter()
+{
+}
+
+// @brief ファイルに書き出す．
+bool
+AlgPlaWriter::write(
+  const string& filename,
+  const vector<AlgCover>& cover_list
+)
+{
+  std::ofstream s{filename};
+  if ( !s ) {
+    return false;
+  }
+  write(s, cover_list);
+  return static_cast<bool>(s);
+}
+
+// @brief ストリームに書き出す．
+void
+AlgPlaWriter::write(
+  ostream& s,
+  const vector<AlgCover>& cover_list
+)
+{
+  ASSERT_COND( !cover_list.empty() );
+
+  auto& mgr = cover_list.front().mgr();
+  SizeType ni = mgr.variable_num();
+  SizeType no = cover_list.size();
+  SizeType np = 0;
+  for ( auto& cover: cover_list ) {
+    ASSERT_COND( &cover.mgr() == &mgr );
+    np += cover.cube_num();
+  }
+
+  s << ".i " << ni << endl
+    << ".o " << no << endl
+    << ".ilb";
+  for ( SizeType var = 0; var < ni; ++ var ) {
+    s << " " << mgr.varname(var);
+  }
+  s << endl;
+  if ( !mOutputNameList.empty() ) {
+    ASSERT_COND( mOutputNameList.size() == no );
+    s << ".ob";
+    for ( auto& name: mOutputNameList ) {
+      s << " " << name;
+    }
+    s << endl;
+  }
+  s << ".p " << np << endl;
+
+  // 1行分のバッファ
+  // 出力部は書き出すカバーの位置だけ '1' にする．
+  string line(ni + 1 + no + 1, '0');
+  line[ni] = ' ';
+  line[ni + 1 + no] = '\n';
+  for ( SizeType k = 0; k < no; ++ k ) {
+    auto& cover = cover_list[k];
+    line[ni + 1 + k] = '1';
+    for ( SizeType i = 0; i < cover.cube_num(); ++ i ) {
+      for ( SizeType var = 0; var < ni; ++ var ) {
+	switch ( mgr.literal(cover.mBody, i, var) ) {
+	case kAlgPolP: line[var] = '1'; break;
+	case kAlgPolN: line[var] = '0'; break;
+	default:       line[var] = '-'; break;
+	}
+      }
+      s.write(line.data(), line.size());
+    }
+    line[ni + 1 + k] = '0';
+  }
+  s << ".e" << endl;
+}
+
+END_NAMESPACE_YM_BFO
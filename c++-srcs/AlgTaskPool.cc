@@ -0,0 +1,171 @@
+
+/// @file AlgTaskPool.cc
+/// @brief AlgTaskPool の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "AlgTaskPool.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+BEGIN_NONAMESPACE
+
+// 現在のスレッドが属しているプール
+thread_local AlgTaskPool* tPool = nullptr;
+
+// 現在のスレッドのワーカー番号
+thread_local SizeType tWorkerId = 0;
+
+END_NONAMESPACE
+
+//////////////////////////////////////////////////////////////////////
+// クラス AlgTaskPool
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+AlgTaskPool::AlgTaskPool(
+  SizeType thread_num
+)
+{
+  if ( thread_num == 0 ) {
+    thread_num = 1;
+  }
+  mQueueList.reserve(thread_num);
+  for ( SizeType i = 0; i < thread_num; ++ i ) {
+    mQueueList.push_back(unique_ptr<Queue>{new Queue});
+  }
+  mThreadList.reserve(thread_num);
+  for ( SizeType i = 0; i < thread_num; ++ i ) {
+    mThreadList.push_back(std::thread{[this, i]() { _worker(i); }});
+  }
+}
+
+// @brief デストラクタ
+AlgTaskPool::~AlgTaskPool()
+{
+  {
+    std::lock_guard<std::mutex> lock{mMutex};
+    mStop = true;
+  }
+  mTaskCond.notify_all();
+  for ( auto& th: mThreadList ) {
+    th.join();
+  }
+}
+
+// @brief タスクを投入する．
+void
+AlgTaskPool::submit(
+  Task task
+)
+{
+  SizeType id;
+  if ( tPool == this ) {
+    id = tWorkerId;
+  }
+  else {
+    id = mNextQueue.fetch_add(1) % mQueueList.size();
+  }
+
+  ++ mPendingNum;
+  {
+    // 待っているワーカーが取りこぼさないように
+    // mMutex を取ってから積む．
+    std::lock_guard<std::mutex> lock{mMutex};
+    auto& queue = *mQueueList[id];
+    std::lock_guard<std::mutex> qlock{queue.mMutex};
+    queue.mTaskList.push_back(std::move(task));
+    ++ mQueuedNum;
+  }
+  mTaskCond.notify_one();
+}
+
+// @brief 投入されたすべてのタスクが終わるまで待つ．
+void
+AlgTaskPool::wait()
+{
+  std::unique_lock<std::mutex> lock{mMutex};
+  mDoneCond.wait(lock, [this]() { return mPendingNum == 0; });
+  if ( mException ) {
+    auto e = mException;
+    mException = nullptr;
+    std::rethrow_exception(e);
+  }
+}
+
+// @brief ワーカースレッドの本体
+void
+AlgTaskPool::_worker(
+  SizeType id
+)
+{
+  tPool = this;
+  tWorkerId = id;
+  for ( ; ; ) {
+    Task task;
+    if ( _pop(id, task) ) {
+      try {
+	task();
+      }
+      catch ( ... ) {
+	std::lock_guard<std::mutex> lock{mMutex};
+	if ( !mException ) {
+	  mException = std::current_exception();
+	}
+      }
+      // 捕獲した変数の解放もタスクの一部とみなす．
+      task = nullptr;
+      if ( -- mPendingNum == 0 ) {
+	std::lock_guard<std::mutex> lock{mMutex};
+	mDoneCond.notify_all();
+      }
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock{mMutex};
+    mTaskCond.wait(lock, [this]() { return mStop || mQueuedNum > 0; });
+    if ( mStop && mQueuedNum == 0 ) {
+      break;
+    }
+  }
+  tPool = nullptr;
+}
+
+// @brief 実行するタスクを取り出す．
+bool
+AlgTaskPool::_pop(
+  SizeType id,
+  Task& task
+)
+{
+  SizeType n = mQueueList.size();
+  {
+    // 自分のキューは末尾から取り出す．
+    auto& queue = *mQueueList[id];
+    std::lock_guard<std::mutex> lock{queue.mMutex};
+    if ( !queue.mTaskList.empty() ) {
+      task = std::move(queue.mTaskList.back());
+      queue.mTaskList.pop_back();
+      -- mQueuedNum;
+      return true;
+    }
+  }
+  // 他のキューの先頭から盗む．
+  for ( SizeType k = 1; k < n; ++ k ) {
+    auto& queue = *mQueueList[(id + k) % n];
+    std::lock_guard<std::mutex> lock{queue.mMutex};
+    if ( !queue.mTaskList.empty() ) {
+      task = std::move(queue.mTaskList.front());
+      queue.mTaskList.pop_front();
+      -- mQueuedNum;
+      return true;
+    }
+  }
+  return false;
+}
+
+END_NAMESPACE_YM_BFO
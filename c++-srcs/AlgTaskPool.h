@@ -0,0 +1,162 @@
+#ifndef ALGTASKPOOL_H
+#define ALGTASKPOOL_H
+
+/// @file AlgTaskPool.h
+/// @brief AlgTaskPool のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/bfo_nsdef.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgTaskPool AlgTaskPool.h "AlgTaskPool.h"
+/// @brief work-stealing 方式のスレッドプール
+///
+/// ワーカースレッドごとにタスクのキューを持つ．<br>
+/// ワーカーの中から投入されたタスクは自分のキューの末尾に積まれ，
+/// 自分のキューは末尾から(LIFO)取り出す．
+/// 自分のキューが空の時は他のワーカーのキューの先頭から盗む．<br>
+/// これにより再帰的に分岐するタスクでも深さ優先に近い順で処理され，
+/// 盗まれるのは根に近い大きなタスクとなる．
+//////////////////////////////////////////////////////////////////////
+class AlgTaskPool
+{
+public:
+
+  /// @brief タスクを表す型
+  using Task = std::function<void()>;
+
+  /// @brief コンストラクタ
+  ///
+  /// thread_num が 0 の時は 1 とみなす．
+  explicit
+  AlgTaskPool(
+    SizeType thread_num ///< [in] ワーカースレッド数
+  );
+
+  /// @brief デストラクタ
+  ///
+  /// 残っているタスクをすべて処理してからスレッドを終了させる．
+  ~AlgTaskPool();
+
+  // コピーは禁止
+  AlgTaskPool(const AlgTaskPool&) = delete;
+  AlgTaskPool& operator=(const AlgTaskPool&) = delete;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ワーカースレッド数を返す．
+  SizeType
+  thread_num() const
+  {
+    return mThreadList.size();
+  }
+
+  /// @brief タスクを投入する．
+  ///
+  /// タスクの中から呼んでもよい．
+  void
+  submit(
+    Task task ///< [in] タスク
+  );
+
+  /// @brief 投入されたすべてのタスクが終わるまで待つ．
+  ///
+  /// タスクの中から投入されたタスクも含む．<br>
+  /// タスクが例外を送出した場合には最初の例外をここで再送出する．
+  void
+  wait();
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  // ワーカーごとのタスクキュー
+  struct Queue
+  {
+    // 排他制御用のミューテックス
+    std::mutex mMutex;
+
+    // タスクのリスト
+    std::deque<Task> mTaskList;
+  };
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ワーカースレッドの本体
+  void
+  _worker(
+    SizeType id ///< [in] ワーカー番号
+  );
+
+  /// @brief 実行するタスクを取り出す．
+  /// @return 取り出せたら true を返す．
+  bool
+  _pop(
+    SizeType id, ///< [in] ワーカー番号
+    Task& task   ///< [out] 取り出したタスク
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // ワーカーごとのタスクキュー
+  vector<unique_ptr<Queue>> mQueueList;
+
+  // ワーカースレッドのリスト
+  vector<std::thread> mThreadList;
+
+  // 待ち合わせ用のミューテックス
+  std::mutex mMutex;
+
+  // タスクが投入されたことを知らせる条件変数
+  std::condition_variable mTaskCond;
+
+  // すべてのタスクが終わったことを知らせる条件変数
+  std::condition_variable mDoneCond;
+
+  // キューに入っているタスク数
+  std::atomic<SizeType> mQueuedNum{0};
+
+  // 投入されて終わっていないタスク数
+  std::atomic<SizeType> mPendingNum{0};
+
+  // 外部から投入されたタスクを入れるキューの番号
+  std::atomic<SizeType> mNextQueue{0};
+
+  // 終了要求
+  bool mStop{false};
+
+  // タスクが送出した最初の例外
+  std::exception_ptr mException;
+
+};
+
+END_NAMESPACE_YM_BFO
+
+#endif // ALGTASKPOOL_H
@@ -0,0 +1,178 @@
+
+/// @file AlgWorkspace.cc
+/// @brief AlgWorkspace の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "AlgWorkspace.h"
+#include <atomic>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+BEGIN_NONAMESPACE
+
+// AlgWorkspaceTable の通し番号
+// 0 は使わない．
+std::atomic<SizeType> sNextSerial{1};
+
+// 直前に使った作業領域
+struct WsCache
+{
+  // AlgWorkspaceTable の通し番号
+  SizeType mSerial{0};
+
+  // 作業領域
+  AlgWorkspace* mWs{nullptr};
+};
+
+thread_local WsCache tCache;
+
+// 生きている AlgWorkspaceTable の表
+// キーは通し番号
+// スレッド終了時に作業領域を返すために用いる．
+std::mutex sTableMutex;
+unordered_map<SizeType, AlgWorkspaceTable*> sTableMap;
+
+// スレッドが作業領域を登録した AlgWorkspaceTable の通し番号のリスト
+//
+// スレッドの終了時にデストラクタが呼ばれ，まだ生きている表から
+// このスレッドの作業領域を取り除く．
+struct WsGuard
+{
+  // デストラクタ
+  ~WsGuard()
+  {
+    auto id = std::this_thread::get_id();
+    // sTableMutex を握っている間は表は削除されない．
+    std::lock_guard<std::mutex> lock{sTableMutex};
+    for ( auto serial: mSerialList ) {
+      auto p = sTableMap.find(serial);
+      if ( p != sTableMap.end() ) {
+	p->second->release(id);
+      }
+    }
+  }
+
+  // 通し番号のリスト
+  vector<SizeType> mSerialList;
+};
+
+thread_local WsGuard tGuard;
+
+END_NONAMESPACE
+
+//////////////////////////////////////////////////////////////////////
+// クラス AlgWorkspace
+//////////////////////////////////////////////////////////////////////
+
+// @brief 新しいフレームを積む．
+ymuint64*
+AlgWorkspace::push(
+  SizeType size
+)
+{
+  if ( mDepth == mSlotList.size() ) {
+    mSlotList.push_back(Slot{});
+  }
+  auto& slot = mSlotList[mDepth];
+  if ( slot.mCap < size ) {
+    // 倍々で大きくする．
+    // 前の内容は引き継がなくてよい．
+    SizeType new_cap = slot.mCap > 0 ? slot.mCap : 16;
+    while ( new_cap < size ) {
+      new_cap <<= 1;
+    }
+    mStats.reserved_words += new_cap - slot.mCap;
+    slot.mBody.reset(new ymuint64[new_cap]);
+    slot.mCap = new_cap;
+    ++ mStats.alloc_num;
+  }
+  slot.mSize = size;
+  ++ mDepth;
+  mUsedWords += size;
+
+  if ( mStats.max_depth < mDepth ) {
+    mStats.max_depth = mDepth;
+  }
+  if ( mStats.peak_words < mUsedWords ) {
+    mStats.peak_words = mUsedWords;
+  }
+  return slot.mBody.get();
+}
+
+// @brief 一番上のフレームを取り除く．
+void
+AlgWorkspace::pop()
+{
+  ASSERT_COND( mDepth > 0 );
+  -- mDepth;
+  mUsedWords -= mSlotList[mDepth].mSize;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス AlgWorkspaceTable
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+AlgWorkspaceTable::AlgWorkspaceTable(
+) : mSerial{sNextSerial.fetch_add(1)}
+{
+  std::lock_guard<std::mutex> lock{sTableMutex};
+  sTableMap.emplace(mSerial, this);
+}
+
+// @brief デストラクタ
+AlgWorkspaceTable::~AlgWorkspaceTable()
+{
+  std::lock_guard<std::mutex> lock{sTableMutex};
+  sTableMap.erase(mSerial);
+}
+
+// @brief 呼び出したスレッド用の作業領域を返す．
+AlgWorkspace&
+AlgWorkspaceTable::get()
+{
+  if ( tCache.mSerial == mSerial ) {
+    return *tCache.mWs;
+  }
+
+  AlgWorkspace* ws;
+  {
+    std::lock_guard<std::mutex> lock{mMutex};
+    auto& p = mWsMap[std::this_thread::get_id()];
+    if ( p == nullptr ) {
+      p.reset(new AlgWorkspace);
+      // スレッドの終了時に取り除いてもらう．
+      tGuard.mSerialList.push_back(mSerial);
+    }
+    ws = p.get();
+  }
+  tCache.mSerial = mSerial;
+  tCache.mWs = ws;
+  return *ws;
+}
+
+// @brief 作業領域を持っているスレッド数を返す．
+SizeType
+AlgWorkspaceTable::size()
+{
+  std::lock_guard<std::mutex> lock{mMutex};
+  return mWsMap.size();
+}
+
+// @brief 指定されたスレッドの作業領域を削除する．
+void
+AlgWorkspaceTable::release(
+  std::thread::id id
+)
+{
+  std::lock_guard<std::mutex> lock{mMutex};
+  mWsMap.erase(id);
+}
+
+END_NAMESPACE_YM_BFO
@@ -0,0 +1,228 @@
+#ifndef ALGWORKSPACE_H
+#define ALGWORKSPACE_H
+
+/// @file AlgWorkspace.h
+/// @brief AlgWorkspace のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/bfo_nsdef.h"
+#include "ym/AlgMgr.h"
+#include <mutex>
+#include <thread>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgWorkspace AlgWorkspace.h "AlgWorkspace.h"
+/// @brief AlgMgr の演算で用いる作業領域のスタック
+///
+/// 作業領域はフレーム単位で push()/pop() する．<br>
+/// フレームごとに独立した領域を持つので，入れ子になった演算が
+/// 外側のフレームの内容を壊すことはない．<br>
+/// 一度確保した領域は再利用されるので，定常状態ではメモリ確保は
+/// 起こらない．<br>
+/// 通常は Frame を用いてスコープと対応させる．
+//////////////////////////////////////////////////////////////////////
+class AlgWorkspace
+{
+public:
+
+  //////////////////////////////////////////////////////////////////////
+  /// @class Frame AlgWorkspace.h "AlgWorkspace.h"
+  /// @brief スコープと対応したフレーム
+  ///
+  /// コンストラクタで push() し，デストラクタで pop() する．
+  //////////////////////////////////////////////////////////////////////
+  class Frame
+  {
+  public:
+
+    /// @brief コンストラクタ
+    Frame(
+      AlgWorkspace& ws, ///< [in] 作業領域
+      SizeType size     ///< [in] 要求するワード数
+    ) : mWs{ws},
+	mBody{ws.push(size)}
+    {
+    }
+
+    /// @brief デストラクタ
+    ~Frame()
+    {
+      mWs.pop();
+    }
+
+    // コピーは禁止
+    Frame(const Frame&) = delete;
+    Frame& operator=(const Frame&) = delete;
+
+    /// @brief 領域の先頭を返す．
+    ymuint64*
+    body() const
+    {
+      return mBody;
+    }
+
+
+  private:
+    //////////////////////////////////////////////////////////////////////
+    // データメンバ
+    //////////////////////////////////////////////////////////////////////
+
+    // 作業領域
+    AlgWorkspace& mWs;
+
+    // 領域の先頭
+    ymuint64* mBody;
+
+  };
+
+
+public:
+
+  /// @brief コンストラクタ
+  AlgWorkspace() = default;
+
+  /// @brief デストラクタ
+  ~AlgWorkspace() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 新しいフレームを積む．
+  /// @return 領域の先頭を返す．
+  ///
+  /// 領域の内容は不定．
+  ymuint64*
+  push(
+    SizeType size ///< [in] 要求するワード数
+  );
+
+  /// @brief 一番上のフレームを取り除く．
+  void
+  pop();
+
+  /// @brief 統計情報を返す．
+  const AlgWorkspaceStats&
+  stats() const
+  {
+    return mStats;
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  // フレーム用の領域
+  struct Slot
+  {
+    // 領域
+    unique_ptr<ymuint64[]> mBody;
+
+    // 確保されているワード数
+    SizeType mCap{0};
+
+    // 現在要求されているワード数
+    SizeType mSize{0};
+  };
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // フレーム用の領域のリスト
+  // mSlotList[0] 〜 mSlotList[mDepth - 1] が使用中
+  vector<Slot> mSlotList;
+
+  // 現在のフレーム数
+  SizeType mDepth{0};
+
+  // 現在使用中のワード数
+  SizeType mUsedWords{0};
+
+  // 統計情報
+  AlgWorkspaceStats mStats;
+
+};
+
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgWorkspaceTable AlgWorkspace.h "AlgWorkspace.h"
+/// @brief スレッドごとの AlgWorkspace を管理するクラス
+///
+/// AlgMgr ごとに1つ持つ．<br>
+/// 作業領域は最初に使われた時に作られ，そのスレッドが終了するか
+/// このオブジェクトが削除されるまで保持される．<br>
+/// そのため保持される作業領域の数は同時に生きているスレッド数を
+/// 越えない．<br>
+/// 直前に使った作業領域はスレッドローカルな変数に覚えておくので，
+/// 同じマネージャを使い続ける限りロックは取らない．
+//////////////////////////////////////////////////////////////////////
+class AlgWorkspaceTable
+{
+public:
+
+  /// @brief コンストラクタ
+  AlgWorkspaceTable();
+
+  /// @brief デストラクタ
+  ~AlgWorkspaceTable();
+
+  // コピーは禁止
+  AlgWorkspaceTable(const AlgWorkspaceTable&) = delete;
+  AlgWorkspaceTable& operator=(const AlgWorkspaceTable&) = delete;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 呼び出したスレッド用の作業領域を返す．
+  AlgWorkspace&
+  get();
+
+  /// @brief 作業領域を持っているスレッド数を返す．
+  SizeType
+  size();
+
+  /// @brief 指定されたスレッドの作業領域を削除する．
+  ///
+  /// スレッドの終了時に呼ばれる．
+  void
+  release(
+    std::thread::id id ///< [in] スレッドID
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 通し番号
+  // 同じアドレスに作られたオブジェクトを区別するために用いる．
+  SizeType mSerial;
+
+  // mWsMap 用のミューテックス
+  std::mutex mMutex;
+
+  // スレッドIDをキーにして作業領域を保持するハッシュ表
+  unordered_map<std::thread::id, unique_ptr<AlgWorkspace>> mWsMap;
+
+};
+
+END_NAMESPACE_YM_BFO
+
+#endif // ALGWORKSPACE_H
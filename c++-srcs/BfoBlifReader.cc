@@ -0,0 +1,362 @@
+
+/// @file BfoBlifReader.cc
+/// @brief BfoBlifReader の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/BfoBlifReader.h"
+#include "ym/AlgMgr.h"
+#include <fstream>
+#include <sstream>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+BEGIN_NONAMESPACE
+
+// 空白文字の時 true を返す．
+inline
+bool
+_is_space(
+  char c
+)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+}
+
+// 文字列を空白で区切る．
+// 結果は str の中を指す．
+void
+_split(
+  const string& str,
+  vector<std::string_view>& token_list
+)
+{
+  token_list.clear();
+  const char* p = str.data();
+  const char* end = p + str.size();
+  while ( p < end ) {
+    while ( p < end && _is_space(*p) ) {
+      ++ p;
+    }
+    const char* start = p;
+    while ( p < end && !_is_space(*p) ) {
+      ++ p;
+    }
+    if ( start < p ) {
+      token_list.push_back(std::string_view{start, static_cast<SizeType>(p - start)});
+    }
+  }
+}
+
+END_NONAMESPACE
+
+//////////////////////////////////////////////////////////////////////
+// クラス BfoBlifReader
+//////////////////////////////////////////////////////////////////////
+
+// @brief ファイルを読み込む．
+bool
+BfoBlifReader::read(
+  const string& filename,
+  BfoNetwork& network
+)
+{
+  std::ifstream s{filename};
+  if ( !s ) {
+    mLineNo = 0;
+    return _error(filename + ": No such file");
+  }
+  return read(s, network);
+}
+
+// @brief ストリームから読み込む．
+bool
+BfoBlifReader::read(
+  istream& s,
+  BfoNetwork& network
+)
+{
+  ASSERT_COND( network.node_num() == 0 );
+
+  mNetwork = &network;
+  mModelName = string{};
+  mNodeMap.clear();
+  mDefined.clear();
+  mOutputNameList.clear();
+  mLine.clear();
+  mLineNo = 0;
+  mCurId = kBadId;
+  mErrorMessage = string{};
+
+  bool ok = true;
+  bool end = false;
+  while ( ok && !end && _read_line(s) ) {
+    if ( mTokenList[0][0] == '.' ) {
+      if ( mCurId != kBadId ) {
+	_end_names();
+      }
+      ok = _read_command(end);
+    }
+    else if ( mCurId == kBadId ) {
+      ok = _error("unexpected line");
+    }
+    else {
+      ok = _read_cube();
+    }
+  }
+  if ( !ok ) {
+    return false;
+  }
+  if ( mCurId != kBadId ) {
+    _end_names();
+  }
+
+  // ここからのエラーには行番号をつけない．
+  mLineNo = 0;
+  for ( SizeType id = 0; id < network.node_num(); ++ id ) {
+    if ( network.is_valid(id) && !mDefined[id] ) {
+      return _error(network.name(id) + ": undefined");
+    }
+  }
+  for ( auto& name: mOutputNameList ) {
+    auto p = mNodeMap.find(name);
+    if ( p == mNodeMap.end() ) {
+      return _error(name + ": undefined");
+    }
+    network.add_output(p->second);
+  }
+
+  return true;
+}
+
+// @brief 論理的な1行を読み込んでトークンに分ける．
+bool
+BfoBlifReader::_read_line(
+  istream& s
+)
+{
+  mLine.clear();
+  while ( getline(s, mBuff) ) {
+    ++ mLineNo;
+    // コメントを取り除く．
+    auto pos = mBuff.find('#');
+    if ( pos != string::npos ) {
+      mBuff.erase(pos);
+    }
+    // 末尾の空白を取り除く．
+    SizeType n = mBuff.size();
+    while ( n > 0 && _is_space(mBuff[n - 1]) ) {
+      -- n;
+    }
+    bool cont = n > 0 && mBuff[n - 1] == '\\';
+    if ( cont ) {
+      -- n;
+    }
+    mLine.append(mBuff, 0, n);
+    mLine.push_back(' ');
+    if ( cont ) {
+      continue;
+    }
+    _split(mLine, mTokenList);
+    if ( !mTokenList.empty() ) {
+      return true;
+    }
+    mLine.clear();
+  }
+  // 最後の行が '\' で終わっていた場合
+  _split(mLine, mTokenList);
+  return !mTokenList.empty();
+}
+
+// @brief ドットで始まる行を処理する．
+bool
+BfoBlifReader::_read_command(
+  bool& end
+)
+{
+  auto cmd = mTokenList[0];
+  if ( cmd == ".model" ) {
+    if ( mTokenList.size() > 1 ) {
+      mModelName = string{mTokenList[1]};
+    }
+  }
+  else if ( cmd == ".inputs" ) {
+    for ( SizeType i = 1; i < mTokenList.size(); ++ i ) {
+      string name{mTokenList[i]};
+      SizeType id = mNetwork->new_input(name);
+      mDefined.resize(mNetwork->node_num(), false);
+      mDefined[id] = true;
+      auto p = mNodeMap.find(name);
+      if ( p == mNodeMap.end() ) {
+	mNodeMap.emplace(name, id);
+      }
+      else if ( mDefined[p->second] ) {
+	return _error(name + ": defined more than once");
+      }
+      else {
+	// 先に参照されていた仮のノードを置き換える．
+	mNetwork->substitute(p->second, id);
+	mNetwork->delete_node(p->second);
+	p->second = id;
+      }
+    }
+  }
+  else if ( cmd == ".outputs" ) {
+    for ( SizeType i = 1; i < mTokenList.size(); ++ i ) {
+      mOutputNameList.push_back(string{mTokenList[i]});
+    }
+  }
+  else if ( cmd == ".names" ) {
+    return _start_names();
+  }
+  else if ( cmd == ".end" ) {
+    end = true;
+  }
+  else if ( cmd == ".latch" || cmd == ".mlatch" || cmd == ".subckt" ||
+	    cmd == ".gate" || cmd == ".exdc" ) {
+    return _error(string{cmd} + ": not supported");
+  }
+  // それ以外のコマンドは無視する．
+  return true;
+}
+
+// @brief .names の開始行を処理する．
+bool
+BfoBlifReader::_start_names()
+{
+  if ( mTokenList.size() < 2 ) {
+    return _error("syntax error in .names");
+  }
+  SizeType ni = mTokenList.size() - 2;
+  if ( ni > mNetwork->mgr().variable_num() ) {
+    return _error("too many fanins");
+  }
+
+  mFaninList.clear();
+  for ( SizeType i = 0; i < ni; ++ i ) {
+    mFaninList.push_back(_find_node(mTokenList[i + 1]));
+  }
+  SizeType id = _find_node(mTokenList.back());
+  if ( mDefined[id] ) {
+    return _error(string{mTokenList.back()} + ": defined more than once");
+  }
+  mDefined[id] = true;
+  mCurId = id;
+  mCubeNum = 0;
+  mOutVal = '\0';
+  return true;
+}
+
+// @brief .names のキューブを表す行を処理する．
+bool
+BfoBlifReader::_read_cube()
+{
+  SizeType ni = mFaninList.size();
+  std::string_view in_part;
+  std::string_view out_part;
+  if ( ni == 0 ) {
+    if ( mTokenList.size() != 1 ) {
+      return _error("syntax error");
+    }
+    out_part = mTokenList[0];
+  }
+  else {
+    if ( mTokenList.size() != 2 ) {
+      return _error("syntax error");
+    }
+    in_part = mTokenList[0];
+    out_part = mTokenList[1];
+    if ( in_part.size() != ni ) {
+      return _error("the size of input part does not match");
+    }
+  }
+  if ( out_part.size() != 1 || (out_part[0] != '0' && out_part[0] != '1') ) {
+    return _error("illegal output part");
+  }
+  char oval = out_part[0];
+  if ( mOutVal != '\0' && mOutVal != oval ) {
+    return _error("ON-set and OFF-set are mixed");
+  }
+  mOutVal = oval;
+  if ( oval == '0' ) {
+    if ( ni > 0 ) {
+      return _error("OFF-set description is not supported");
+    }
+    // 定数0
+    return true;
+  }
+
+  // 入力部を直接本体に書き込む．
+  auto& mgr = mNetwork->mgr();
+  mCubeBuf.resize((mCubeNum + 1) * mgr.cube_size());
+  ymuint64* body = mCubeBuf.data();
+  mgr.cube_clear(body, mCubeNum);
+  for ( SizeType var = 0; var < ni; ++ var ) {
+    char c = in_part[var];
+    switch ( c ) {
+    case '0':
+      mgr.set_literal(body, mCubeNum, var, kAlgPolN);
+      break;
+    case '1':
+      mgr.set_literal(body, mCubeNum, var, kAlgPolP);
+      break;
+    case '-':
+      break;
+    default:
+      return _error(string{"illegal character '"} + c + "' in input part");
+    }
+  }
+  ++ mCubeNum;
+  return true;
+}
+
+// @brief 読み込み中の .names を終える．
+void
+BfoBlifReader::_end_names()
+{
+  auto& mgr = mNetwork->mgr();
+  AlgCover cover{mgr, 0, 0, nullptr};
+  cover.resize(mCubeNum);
+  mgr.copy(mCubeNum, cover.mBody, 0, mCubeBuf.data(), 0);
+  cover.mCubeNum = mgr.sort(mCubeNum, cover.mBody);
+  mNetwork->set_function(mCurId, mFaninList, std::move(cover));
+  mCurId = kBadId;
+}
+
+// @brief 名前に対応するノード番号を返す．
+SizeType
+BfoBlifReader::_find_node(
+  std::string_view name
+)
+{
+  mKey.assign(name.data(), name.size());
+  auto p = mNodeMap.find(mKey);
+  if ( p != mNodeMap.end() ) {
+    return p->second;
+  }
+  SizeType id = mNetwork->new_logic(mKey);
+  mDefined.resize(mNetwork->node_num(), false);
+  mNodeMap.emplace(mKey, id);
+  return id;
+}
+
+// @brief エラーメッセージをセットする．
+bool
+BfoBlifReader::_error(
+  const string& msg
+)
+{
+  std::ostringstream buf;
+  if ( mLineNo > 0 ) {
+    buf << "line " << mLineNo << ": ";
+  }
+  buf << msg;
+  mErrorMessage = buf.str();
+  return false;
+}
+
+END_NAMESPACE_YM_BFO
@@ -0,0 +1,143 @@
+
+/// @file BfoBlifWriter.cc
+/// @brief BfoBlifWriter の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/BfoBlifWriter.h"
+#include "ym/AlgMgr.h"
+#include <fstream>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+BEGIN_NONAMESPACE
+
+// バッファの内容を書き出す目安のサイズ
+const SizeType kBuffSize = 64 * 1024;
+
+END_NONAMESPACE
+
+//////////////////////////////////////////////////////////////////////
+// クラス BfoBlifWriter
+//////////////////////////////////////////////////////////////////////
+
+// @brief ファイルに書き出す．
+bool
+BfoBlifWriter::write(
+  const string& filename,
+  const BfoNetwork& network
+)
+{
+  std::ofstream s{filename};
+  if ( !s ) {
+    return false;
+  }
+  write(s, network);
+  return static_cast<bool>(s);
+}
+
+// @brief ストリームに書き出す．
+void
+BfoBlifWriter::write(
+  ostream& s,
+  const BfoNetwork& network
+)
+{
+  mBuff.clear();
+  mBuff.reserve(kBuffSize + 1024);
+
+  mBuff += ".model ";
+  mBuff += mModelName;
+  mBuff += "\n.inputs";
+  for ( auto id: network.input_list() ) {
+    mBuff += ' ';
+    _put_name(network, id);
+    _flush(s);
+  }
+  mBuff += "\n.outputs";
+  for ( auto id: network.output_list() ) {
+    mBuff += ' ';
+    _put_name(network, id);
+    _flush(s);
+  }
+  mBuff += '\n';
+
+  vector<SizeType> node_list;
+  if ( !network.topological_order(node_list) ) {
+    // ループがある場合はノード番号順に書き出す．
+    node_list.clear();
+    for ( SizeType id = 0; id < network.node_num(); ++ id ) {
+      if ( network.is_valid(id) && network.is_logic(id) ) {
+	node_list.push_back(id);
+      }
+    }
+  }
+  for ( auto id: node_list ) {
+    mBuff += ".names";
+    auto& fanin_list = network.fanin_list(id);
+    for ( auto iid: fanin_list ) {
+      mBuff += ' ';
+      _put_name(network, iid);
+    }
+    mBuff += ' ';
+    _put_name(network, id);
+    mBuff += '\n';
+
+    // 各キューブを1行ずつ書き出す．
+    auto& func = network.function(id);
+    SizeType ni = fanin_list.size();
+    for ( SizeType i = 0; i < func.cube_num(); ++ i ) {
+      for ( SizeType var = 0; var < ni; ++ var ) {
+	switch ( func.literal(i, var) ) {
+	case kAlgPolP: mBuff += '1'; break;
+	case kAlgPolN: mBuff += '0'; break;
+	default:       mBuff += '-'; break;
+	}
+      }
+      if ( ni > 0 ) {
+	mBuff += ' ';
+      }
+      mBuff += "1\n";
+      _flush(s);
+    }
+    _flush(s);
+  }
+  mBuff += ".end\n";
+  _flush(s, true);
+}
+
+// @brief ノード名をバッファに書き込む．
+void
+BfoBlifWriter::_put_name(
+  const BfoNetwork& network,
+  SizeType id
+)
+{
+  auto& name = network.name(id);
+  if ( name.empty() ) {
+    mBuff += 'n';
+    mBuff += std::to_string(id);
+  }
+  else {
+    mBuff += name;
+  }
+}
+
+// @brief 必要ならバッファの内容を書き出す．
+void
+BfoBlifWriter::_flush(
+  ostream& s,
+  bool force
+)
+{
+  if ( force || mBuff.size() >= kBuffSize ) {
+    s.write(mBuff.data(), mBuff.size());
+    mBuff.clear();
+  }
+}
+
+END_NAMESPACE_YM_BFO
@@ -0,0 +1,203 @@
+
+/// @file BfoNetwork.cc
+/// @brief BfoNetwork の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/BfoNetwork.h"
+#include <algorithm>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+BEGIN_NONAMESPACE
+
+// リストから要素を1つ取り除く．
+// 要素の順序は保存しない．
+inline
+void
+_erase_one(
+  vector<SizeType>& id_list,
+  SizeType id
+)
+{
+  auto p = std::find(id_list.begin(), id_list.end(), id);
+  ASSERT_COND( p != id_list.end() );
+  *p = id_list.back();
+  id_list.pop_back();
+}
+
+END_NONAMESPACE
+
+//////////////////////////////////////////////////////////////////////
+// クラス BfoNetwork
+//////////////////////////////////////////////////////////////////////
+
+// @brief 論理ノードをトポロジカル順に並べる．
+bool
+BfoNetwork::topological_order(
+  vector<SizeType>& node_list
+) const
+{
+  node_list.clear();
+  node_list.reserve(mLogicNum);
+
+  // 未処理のファンイン数が 0 になったノードから順に並べる．
+  SizeType n = node_num();
+  vector<SizeType> count(n, 0);
+  for ( SizeType id = 0; id < n; ++ id ) {
+    auto& node = mNodeList[id];
+    if ( node.mType != kLogic ) {
+      continue;
+    }
+    count[id] = node.mFaninList.size();
+    if ( count[id] == 0 ) {
+      node_list.push_back(id);
+    }
+  }
+  auto put_fanouts = [&](SizeType id) {
+    for ( auto oid: mNodeList[id].mFanoutList ) {
+      if ( -- count[oid] == 0 ) {
+	node_list.push_back(oid);
+      }
+    }
+  };
+  for ( auto id: mInputList ) {
+    put_fanouts(id);
+  }
+  for ( SizeType rpos = 0; rpos < node_list.size(); ++ rpos ) {
+    put_fanouts(node_list[rpos]);
+  }
+
+  // ループ上のノードは最後まで残る．
+  return node_list.size() == mLogicNum;
+}
+
+// @brief 外部入力ノードを作る．
+SizeType
+BfoNetwork::new_input(
+  const string& name
+)
+{
+  SizeType id = mNodeList.size();
+  mNodeList.emplace_back(kInput, name, mMgr);
+  mInputList.push_back(id);
+  return id;
+}
+
+// @brief 論理ノードを作る．
+SizeType
+BfoNetwork::new_logic(
+  const string& name
+)
+{
+  SizeType id = mNodeList.size();
+  mNodeList.emplace_back(kLogic, name, mMgr);
+  ++ mLogicNum;
+  return id;
+}
+
+// @brief 論理ノードの関数を変更する．
+void
+BfoNetwork::set_function(
+  SizeType id,
+  const vector<SizeType>& fanin_list,
+  AlgCover&& func
+)
+{
+  ASSERT_COND( is_logic(id) );
+  ASSERT_COND( &func.mgr() == &mMgr );
+  ASSERT_COND( fanin_list.size() <= mMgr.variable_num() );
+
+  _disconnect_fanins(id);
+  for ( auto iid: fanin_list ) {
+    ASSERT_COND( is_valid(iid) );
+    mNodeList[iid].mFanoutList.push_back(id);
+  }
+
+  auto& node = mNodeList[id];
+  node.mFaninList = fanin_list;
+  node.mFunction = std::move(func);
+  mLiteralNum -= node.mLiteralNum;
+  node.mLiteralNum = node.mFunction.literal_num();
+  mLiteralNum += node.mLiteralNum;
+}
+
+// @brief ノードを置き換える．
+void
+BfoNetwork::substitute(
+  SizeType old_id,
+  SizeType new_id
+)
+{
+  ASSERT_COND( is_valid(old_id) );
+  ASSERT_COND( is_valid(new_id) );
+
+  if ( old_id == new_id ) {
+    return;
+  }
+
+  auto& old_node = mNodeList[old_id];
+  auto& new_node = mNodeList[new_id];
+  for ( auto oid: old_node.mFanoutList ) {
+    auto& fanin_list = mNodeList[oid].mFaninList;
+    for ( auto& iid: fanin_list ) {
+      if ( iid == old_id ) {
+	iid = new_id;
+      }
+    }
+    new_node.mFanoutList.push_back(oid);
+  }
+  old_node.mFanoutList.clear();
+
+  for ( auto& id: mOutputList ) {
+    if ( id == old_id ) {
+      id = new_id;
+    }
+  }
+}
+
+// @brief ノードを削除する．
+void
+BfoNetwork::delete_node(
+  SizeType id
+)
+{
+  ASSERT_COND( is_valid(id) );
+  ASSERT_COND( mNodeList[id].mFanoutList.empty() );
+  ASSERT_COND( std::find(mOutputList.begin(), mOutputList.end(), id)
+	       == mOutputList.end() );
+
+  auto& node = mNodeList[id];
+  if ( node.mType == kInput ) {
+    // 外部入力の順序は保存する．
+    mInputList.erase(std::find(mInputList.begin(), mInputList.end(), id));
+  }
+  else {
+    _disconnect_fanins(id);
+    mLiteralNum -= node.mLiteralNum;
+    -- mLogicNum;
+  }
+  node.mType = kDeleted;
+  node.mName = string{};
+  node.mFaninList = vector<SizeType>{};
+  node.mFanoutList = vector<SizeType>{};
+  node.mFunction = AlgCover{mMgr};
+  node.mLiteralNum = 0;
+}
+
+// @brief ファンインとの接続を取り除く．
+void
+BfoNetwork::_disconnect_fanins(
+  SizeType id
+)
+{
+  for ( auto iid: mNodeList[id].mFaninList ) {
+    _erase_one(mNodeList[iid].mFanoutList, id);
+  }
+}
+
+END_NAMESPACE_YM_BFO
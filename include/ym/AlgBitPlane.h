@@ -0,0 +1,148 @@
+#ifndef ALGBITPLANE_H
+#define ALGBITPLANE_H
+
+/// @file AlgBitPlane.h
+/// @brief AlgBitPlane のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/bfo_nsdef.h"
+#include "ym/AlgCover.h"
+#include "ym/AlgCube.h"
+#include "ym/AlgMgr.h"
+#include "ym/AlgLiteral.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgBitPlane AlgBitPlane.h "ym/AlgBitPlane.h"
+/// @brief カバーを転置した(ビットプレーン形式の)表現
+///
+/// AlgCover はキューブごとに全変数のビットを並べているが，
+/// こちらはリテラルごとに全キューブのビットを並べる．
+/// i 番目のキューブがリテラル L を含む時，L のプレーンの
+/// i ビット目が 1 となる．<br>
+/// 「リテラル L を含むキューブ」のような変数(列)単位の問い合わせは
+/// プレーンを1回なめるだけで答えられる．<br>
+/// 変換は AlgMgr::to_bitplane()/from_bitplane() で行う．
+/// キューブの順序は変換前と変わらない．
+//////////////////////////////////////////////////////////////////////
+class AlgBitPlane
+{
+public:
+
+  /// @brief コンストラクタ
+  explicit
+  AlgBitPlane(
+    const AlgCover& cover ///< [in] 変換元のカバー
+  );
+
+  /// @brief デストラクタ
+  ~AlgBitPlane() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief マネージャを返す．
+  AlgMgr&
+  mgr() const
+  {
+    return *mMgr;
+  }
+
+  /// @brief 変数の数を返す．
+  SizeType
+  variable_num() const
+  {
+    return mMgr->variable_num();
+  }
+
+  /// @brief キューブの数を返す．
+  SizeType
+  cube_num() const
+  {
+    return mCubeNum;
+  }
+
+  /// @brief プレーン1枚分のワード数を返す．
+  SizeType
+  plane_size() const
+  {
+    return mPlaneSize;
+  }
+
+  /// @brief リテラルのプレーンを返す．
+  ///
+  /// plane_size() ワードの領域を指す．
+  const ymuint64*
+  plane(
+    AlgLiteral lit ///< [in] 対象のリテラル
+  ) const
+  {
+    ASSERT_COND( static_cast<SizeType>(lit.varid()) < variable_num() );
+    return &mPlanes[lit.index() * mPlaneSize];
+  }
+
+  /// @brief リテラル数を返す．
+  SizeType
+  literal_num() const;
+
+  /// @brief 指定されたリテラルの出現回数を返す．
+  SizeType
+  literal_num(
+    AlgLiteral lit ///< [in] 対象のリテラル
+  ) const;
+
+  /// @brief 指定されたリテラルを含むキューブ番号のリストを返す．
+  vector<SizeType>
+  cube_list(
+    AlgLiteral lit ///< [in] 対象のリテラル
+  ) const;
+
+  /// @brief すべてのキューブに共通なキューブを返す．
+  ///
+  /// 共通なリテラルがないときは空のキューブを返す．
+  AlgCube
+  common_cube() const;
+
+  /// @brief リテラルによる商を計算する．
+  AlgCover
+  operator/(
+    AlgLiteral lit ///< [in] 対象のリテラル
+  ) const;
+
+  /// @brief AlgCover に戻す．
+  AlgCover
+  to_cover() const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // マネージャ
+  AlgMgr* mMgr;
+
+  // キューブ数
+  SizeType mCubeNum;
+
+  // プレーン1枚分のワード数
+  SizeType mPlaneSize;
+
+  // プレーンの本体
+  // リテラル番号(AlgLiteral::index())の順に並べる．
+  vector<ymuint64> mPlanes;
+
+};
+
+END_NAMESPACE_YM_BFO
+
+#endif // ALGBITPLANE_H
@@ -30,6 +30,13 @@ BEGIN_NAMESPACE_YM_BFO
 //////////////////////////////////////////////////////////////////////
 class AlgCover
 {
+  friend class AlgFastExtract;
+  friend class AlgPlaReader;
+  friend class AlgPlaWriter;
+  friend class AlgCoverView;
+  friend class AlgBitPlane;
+  friend class BfoBlifReader;
+
 public:
 
   /// @brief コンストラクタ
@@ -47,7 +54,7 @@ public:
       const AlgCube& cube = cube_list[i];
       mMgr->cube_copy(mBody, i, cube.mBody, 0);
     }
-    mMgr->sort(mCubeNum, mBody);
+    mCubeNum = mMgr->sort(mCubeNum, mBody);
   }
 
   /// @brief 特殊なコンストラクタ
@@ -87,45 +94,61 @@ public:
     resize(mCubeNum);
     // 内容をセットする．
     mMgr->set_literal(mBody, 0, lit_list);
-    mMgr->sort(mCubeNum, mBody);
-  }
-
-  /// @brief コンストラクタ
-  AlgCover(
-    AlgMgr& mgr,    ///< [in] マネージャ
-    const char* str ///< [in] カバーを表す文字列
-  ) : mMgr{&mgr}
-  {
-    vector<AlgLiteral> lit_list;
-    mCubeNum = mMgr->parse(str, lit_list);
-    resize(mCubeNum);
-    mMgr->set_literal(mBody, 0, lit_list);
-    mMgr->sort(mCubeNum, mBody);
+    mCubeNum = mMgr->sort(mCubeNum, mBody);
   }
 
   /// @brief コンストラクタ
+  ///
+  /// 文字列を直接本体に書き込む．<br>
+  /// 文字列が不正だった場合には空のカバーとなる．
   AlgCover(
-    AlgMgr& mgr,      ///< [in] マネージャ
-    const string& str ///< [in] カバーを表す文字列
+    AlgMgr& mgr,         ///< [in] マネージャ
+    std::string_view str ///< [in] カバーを表す文字列
   ) : mMgr{&mgr}
   {
-    vector<AlgLiteral> lit_list;
-    mCubeNum = mMgr->parse(str.c_str(), lit_list);
-    resize(mCubeNum);
-    mMgr->set_literal(mBody, 0, lit_list);
-    mMgr->sort(mCubeNum, mBody);
+    resize(AlgMgr::parse_cube_num(str));
+    SizeType err_pos;
+    mCubeNum = mMgr->parse(str, mBody, err_pos);
+    mCubeNum = mMgr->sort(mCubeNum, mBody);
   }
 
   /// @brief コピーコンストラクタ
   AlgCover(
     const AlgCover& src ///< [in] コピー元のオブジェクト
   ) : mMgr{src.mMgr},
-      mCubeNum{src.mCubeNum}
+      mCubeNum{src.mCubeNum},
+      mUseSig{src.mUseSig},
+      mSigList{src.mSigList}
   {
     resize(mCubeNum);
     mMgr->copy(mCubeNum, mBody, 0, src.mBody, 0);
   }
 
+  /// @brief ムーブコンストラクタ
+  ///
+  /// src は空のカバーになる．
+  AlgCover(
+    AlgCover&& src ///< [in] ムーブ元のオブジェクト
+  ) noexcept : mMgr{src.mMgr},
+	       mCubeNum{src.mCubeNum},
+	       mCubeCap{src.mCubeCap},
+	       mBody{src.mBody},
+	       mUseSig{src.mUseSig},
+	       mSigList{std::move(src.mSigList)}
+  {
+    if ( src._is_inline() ) {
+      // 内部の領域は引き継げないのでコピーする．
+      _copy_inline(src);
+    }
+    else {
+      src.mCubeCap = 0;
+      src.mBody = nullptr;
+    }
+    src.mCubeNum = 0;
+    src.mUseSig = false;
+    src.mSigList.clear();
+  }
+
   /// @brief 代入演算子
   /// @return 代入後の自身の参照を返す．
   AlgCover&
@@ -134,19 +157,38 @@ public:
   )
   {
     if ( &src != this ) {
-      SizeType old_cap = mCubeCap;
-      ymuint64* old_body = mBody;
-      mCubeNum = src.mCubeNum;
-      resize(mCubeNum);
-      if ( old_body != mBody ) {
-	mgr().delete_body(mBody, old_cap);
+      if ( mMgr == src.mMgr && src.mCubeNum <= mCubeCap ) {
+	// 今の領域をそのまま使う．
+	mCubeNum = src.mCubeNum;
+	mMgr->copy(mCubeNum, mBody, 0, src.mBody, 0);
+	mUseSig = src.mUseSig;
+	mSigList = src.mSigList;
+      }
+      else {
+	// 新しい領域を作って入れ替える．
+	// 古い領域は tmp のデストラクタで削除される．
+	AlgCover tmp{src};
+	swap(tmp);
       }
-      mMgr->copy(mCubeNum, mBody, 0, src.mBody, 0);
     }
 
     return *this;
   }
 
+  /// @brief ムーブ代入演算子
+  /// @return 代入後の自身の参照を返す．
+  ///
+  /// src には自身の元の内容が入る．
+  AlgCover&
+  operator=(
+    AlgCover&& src ///< [in] ムーブ元のオブジェクト
+  ) noexcept
+  {
+    swap(src);
+
+    return *this;
+  }
+
   /// @brief キューブからの変換コンストラクタ
   ///
   /// 指定されたキューブのみのカバーとなる．
@@ -165,7 +207,7 @@ public:
   /// ここに属しているすべてのキューブは削除される．
   ~AlgCover()
   {
-    mMgr->delete_body(mBody, mCubeCap);
+    _delete_body(mBody, mCubeCap);
   }
 
 
@@ -174,6 +216,94 @@ public:
   // 外部インターフェイス
   //////////////////////////////////////////////////////////////////////
 
+  /// @brief 他のキューブに含まれるキューブを取り除く．
+  ///
+  /// 単一キューブ包含(single cube containment)に関して極小にする．
+  void
+  make_scc_minimal()
+  {
+    mCubeNum = mgr().scc_minimal(mCubeNum, mBody,
+				 mUseSig ? mSigList.data() : nullptr);
+    if ( mUseSig ) {
+      mSigList.resize(mCubeNum);
+    }
+  }
+
+  /// @brief キューブごとのシグネチャを保持するようにする．
+  ///
+  /// シグネチャは AlgMgr::cube_signature() で求めたもので，
+  /// 以降は内容を変更する演算のたびに更新される．
+  /// 自身から作られた演算結果のカバーにも引き継がれる．<br>
+  /// 保持していると除算と SCC 極小化でシグネチャを求め直さずに済む．
+  void
+  enable_signature()
+  {
+    mUseSig = true;
+    _update_signature();
+  }
+
+  /// @brief キューブごとのシグネチャを捨てる．
+  void
+  disable_signature()
+  {
+    mUseSig = false;
+    mSigList = vector<ymuint64>{};
+  }
+
+  /// @brief キューブごとのシグネチャを保持している時 true を返す．
+  bool
+  has_signature() const
+  {
+    return mUseSig;
+  }
+
+  /// @brief キューブのシグネチャを返す．
+  ///
+  /// has_signature() が false の時は毎回計算する．
+  ymuint64
+  signature(
+    SizeType cube_id ///< [in] キューブ番号 ( 0 <= cube_id < cube_num() )
+  ) const
+  {
+    ASSERT_COND( cube_id < cube_num() );
+
+    if ( mUseSig ) {
+      return mSigList[cube_id];
+    }
+    ymuint64 sig;
+    mgr().cube_signature(&sig, 1, mBody + cube_id * mgr().cube_size());
+    return sig;
+  }
+
+  /// @brief 内容を入れ替える．
+  void
+  swap(
+    AlgCover& right ///< [in] 入れ替える相手
+  ) noexcept
+  {
+    std::swap(mMgr, right.mMgr);
+    std::swap(mCubeNum, right.mCubeNum);
+    std::swap(mCubeCap, right.mCubeCap);
+    std::swap(mUseSig, right.mUseSig);
+    mSigList.swap(right.mSigList);
+    bool inline1 = _is_inline();
+    bool inline2 = right._is_inline();
+    if ( inline1 && inline2 ) {
+      std::swap(mInline, right.mInline);
+    }
+    else if ( inline1 ) {
+      mBody = right.mBody;
+      right._copy_inline(*this);
+    }
+    else if ( inline2 ) {
+      right.mBody = mBody;
+      _copy_inline(right);
+    }
+    else {
+      std::swap(mBody, right.mBody);
+    }
+  }
+
   /// @brief マネージャを返す．
   AlgMgr&
   mgr() const
@@ -212,6 +342,30 @@ public:
     return mgr().literal_num(cube_num(), mBody, lit);
   }
 
+  /// @brief 全リテラルの出現回数を返す．
+  ///
+  /// 結果は AlgLiteral::index() でインデックスづけられた配列となる．
+  vector<SizeType>
+  literal_histogram() const
+  {
+    vector<SizeType> counts;
+    mgr().literal_histogram(cube_num(), mBody, counts);
+    return counts;
+  }
+
+  /// @brief min_num 回以上現れるリテラルを出現頻度の昇順に並べる．
+  ///
+  /// 出現回数が等しいリテラルは AlgLiteral::index() の昇順とする．
+  vector<AlgLiteral>
+  literal_list_by_frequency(
+    SizeType min_num = 2 ///< [in] 出現回数の下限
+  ) const
+  {
+    vector<AlgLiteral> lit_list;
+    mgr().literal_list_by_frequency(cube_num(), mBody, min_num, lit_list);
+    return lit_list;
+  }
+
   /// @brief 指定された位置のリテラルの極性を返す．
   AlgPol
   literal(
@@ -229,17 +383,32 @@ public:
   AlgCover
   operator+(
     const AlgCover& right ///< [in] オペランド
-  ) const
+  ) const &
   {
     ASSERT_COND( variable_num() == right.variable_num() );
 
     SizeType nc1 = cube_num();
     SizeType nc2 = right.cube_num();
-    SizeType cap = get_capacity(nc1 + nc2);
-    ymuint64* body = mgr().new_body(cap);
-    SizeType nc = mgr().sum(body, nc1, mBody, nc2, right.mBody);
+    AlgCover ans{mgr(), 0, 0, nullptr};
+    ans.resize(nc1 + nc2);
+    ans.mCubeNum = mgr().sum(ans.mBody, nc1, mBody, nc2, right.mBody);
+    ans._inherit_signature(*this);
+    ans._auto_scc();
+
+    return ans;
+  }
 
-    return AlgCover(mgr(), nc, cap, body);
+  /// @brief 論理和を計算する．
+  /// @return 計算結果を返す．
+  ///
+  /// 自身が右辺値の場合には自身の領域を使って計算する．
+  AlgCover
+  operator+(
+    const AlgCover& right ///< [in] オペランド
+  ) &&
+  {
+    operator+=(right);
+    return std::move(*this);
   }
 
   /// @brief 論理和を計算して代入する．
@@ -255,11 +424,15 @@ public:
     SizeType nc2 = right.cube_num();
     SizeType old_cap = mCubeCap;
     ymuint64* old_body = mBody;
+    // 自分自身との和の場合，resize() 後の right.mBody は新しい領域を指す．
+    const ymuint64* rbody = (&right == this) ? old_body : right.mBody;
     resize(nc1 + nc2);
-    mCubeNum = mgr().sum(mBody, nc1, old_body, nc2, right.mBody);
+    mCubeNum = mgr().sum(mBody, nc1, old_body, nc2, rbody);
+    _update_signature();
     if ( old_body != mBody ) {
-      mgr().delete_body(old_body, old_cap);
+      _delete_body(old_body, old_cap);
     }
+    _auto_scc();
 
     return *this;
   }
@@ -269,17 +442,32 @@ public:
   AlgCover
   operator+(
     const AlgCube& right ///< [in] オペランド
-  ) const
+  ) const &
   {
     ASSERT_COND( variable_num() == right.variable_num() );
 
     SizeType nc1 = cube_num();
     SizeType nc2 = 1;
-    SizeType cap = get_capacity(nc1 + nc2);
-    ymuint64* body = mgr().new_body(cap);
-    SizeType nc = mgr().sum(body, nc1, mBody, nc2, right.mBody);
+    AlgCover ans{mgr(), 0, 0, nullptr};
+    ans.resize(nc1 + nc2);
+    ans.mCubeNum = mgr().sum(ans.mBody, nc1, mBody, nc2, right.mBody);
+    ans._inherit_signature(*this);
+    ans._auto_scc();
 
-    return AlgCover(mgr(), nc, cap, body);
+    return ans;
+  }
+
+  /// @brief 論理和を計算する(キューブ版)．
+  /// @return 計算結果を返す．
+  ///
+  /// 自身が右辺値の場合には自身の領域を使って計算する．
+  AlgCover
+  operator+(
+    const AlgCube& right ///< [in] オペランド
+  ) &&
+  {
+    operator+=(right);
+    return std::move(*this);
   }
 
   /// @brief 論理和を計算して代入する(キューブ版)．
@@ -297,9 +485,11 @@ public:
     ymuint64* old_body = mBody;
     resize(nc1 + nc2);
     mCubeNum = mgr().sum(mBody, nc1, old_body, nc2, right.mBody);
+    _update_signature();
     if ( old_body != mBody ) {
-      mgr().delete_body(old_body, old_cap);
+      _delete_body(old_body, old_cap);
     }
+    _auto_scc();
 
     return *this;
   }
@@ -311,17 +501,33 @@ public:
   AlgCover
   operator-(
     const AlgCover& right ///< [in] オペランド
-  ) const
+  ) const &
   {
     ASSERT_COND( variable_num() == right.variable_num() );
 
     SizeType nc1 = cube_num();
     SizeType nc2 = right.cube_num();
-    SizeType cap = get_capacity(nc1);
-    ymuint64* body = mgr().new_body(cap);
-    SizeType nc = mgr().diff(body, nc1, mBody, nc2, right.mBody);
+    AlgCover ans{mgr(), 0, 0, nullptr};
+    ans.resize(nc1);
+    ans.mCubeNum = mgr().diff(ans.mBody, nc1, mBody, nc2, right.mBody);
+    ans._inherit_signature(*this);
 
-    return AlgCover(mgr(), nc, cap, body);
+    return ans;
+  }
+
+  /// @brief 差分を計算する．
+  /// @return 計算結果を返す．
+  ///
+  /// right のみに含まれる要素があっても無視される．
+  ///
+  /// 自身が右辺値の場合には自身の領域を使って計算する．
+  AlgCover
+  operator-(
+    const AlgCover& right ///< [in] オペランド
+  ) &&
+  {
+    operator-=(right);
+    return std::move(*this);
   }
 
   /// @brief 差分を計算して代入する．
@@ -337,6 +543,7 @@ public:
     SizeType nc2 = right.cube_num();
     // 結果のキューブ数は減るだけなのでキューブ容量の変更はしない．
     mCubeNum = mgr().diff(mBody, nc1, mBody, nc2, right.mBody);
+    _update_signature();
 
     return *this;
   }
@@ -348,17 +555,33 @@ public:
   AlgCover
   operator-(
     const AlgCube& right ///< [in] オペランド
-  ) const
+  ) const &
   {
     ASSERT_COND( variable_num() == right.variable_num() );
 
     SizeType nc1 = cube_num();
     SizeType nc2 = 1;
-    SizeType cap = get_capacity(nc1);
-    ymuint64* body = mgr().new_body(cap);
-    SizeType nc = mgr().diff(body, nc1, mBody, nc2, right.mBody);
+    AlgCover ans{mgr(), 0, 0, nullptr};
+    ans.resize(nc1);
+    ans.mCubeNum = mgr().diff(ans.mBody, nc1, mBody, nc2, right.mBody);
+    ans._inherit_signature(*this);
 
-    return AlgCover(mgr(), nc, cap, body);
+    return ans;
+  }
+
+  /// @brief 差分を計算する(キューブ版)．
+  /// @return 計算結果を返す．
+  ///
+  /// right のみに含まれる要素があっても無視される．
+  ///
+  /// 自身が右辺値の場合には自身の領域を使って計算する．
+  AlgCover
+  operator-(
+    const AlgCube& right ///< [in] オペランド
+  ) &&
+  {
+    operator-=(right);
+    return std::move(*this);
   }
 
   /// @brief 差分を計算して代入する(キューブ版)．
@@ -374,6 +597,7 @@ public:
     SizeType nc2 = 1;
     // 結果のキューブ数は減るだけなのでキューブ容量の変更はしない．
     mCubeNum = mgr().diff(mBody, nc1, mBody, nc2, right.mBody);
+    _update_signature();
 
     return *this;
   }
@@ -383,17 +607,32 @@ public:
   AlgCover
   operator*(
     const AlgCover& right ///< [in] オペランド
-  ) const
+  ) const &
   {
     ASSERT_COND( variable_num() == right.variable_num() );
 
     SizeType nc1 = cube_num();
     SizeType nc2 = right.cube_num();
-    SizeType cap = get_capacity(nc1 * nc2);
-    ymuint64* body = mgr().new_body(cap);
-    SizeType nc = mgr().product(body, nc1, mBody, nc2, right.mBody);
+    AlgCover ans{mgr(), 0, 0, nullptr};
+    ans.resize(nc1 * nc2);
+    ans.mCubeNum = mgr().product(ans.mBody, nc1, mBody, nc2, right.mBody);
+    ans._inherit_signature(*this);
+    ans._auto_scc();
 
-    return AlgCover(mgr(), nc, cap, body);
+    return ans;
+  }
+
+  /// @brief 論理積を計算する．
+  /// @return 計算結果を返す．
+  ///
+  /// 自身が右辺値の場合には自身の領域を使って計算する．
+  AlgCover
+  operator*(
+    const AlgCover& right ///< [in] オペランド
+  ) &&
+  {
+    operator*=(right);
+    return std::move(*this);
   }
 
   /// @brief 論理積を計算して代入する．
@@ -409,12 +648,16 @@ public:
     SizeType nc2 = right.cube_num();
     SizeType old_cap = mCubeCap;
     ymuint64* old_body = mBody;
+    // 自分自身との積の場合，resize() 後の right.mBody は新しい領域を指す．
+    const ymuint64* rbody = (&right == this) ? old_body : right.mBody;
     SizeType cap = nc1 * nc2;
     resize(cap);
-    mCubeNum = mgr().product(mBody, nc1, old_body, nc2, right.mBody);
+    mCubeNum = mgr().product(mBody, nc1, old_body, nc2, rbody);
+    _update_signature();
     if ( old_body != mBody ) {
-      mgr().delete_body(old_body, old_cap);
+      _delete_body(old_body, old_cap);
     }
+    _auto_scc();
 
     return *this;
   }
@@ -424,17 +667,32 @@ public:
   AlgCover
   operator*(
     const AlgCube& right ///< [in] オペランド
-  ) const
+  ) const &
   {
     ASSERT_COND( variable_num() == right.variable_num() );
 
     SizeType nc1 = cube_num();
     SizeType nc2 = 1;
-    SizeType cap = get_capacity(nc1 * nc2);
-    ymuint64* body = mgr().new_body(cap);
-    SizeType nc = mgr().product(body, nc1, mBody, nc2, right.mBody);
+    AlgCover ans{mgr(), 0, 0, nullptr};
+    ans.resize(nc1 * nc2);
+    ans.mCubeNum = mgr().product(ans.mBody, nc1, mBody, nc2, right.mBody);
+    ans._inherit_signature(*this);
+    ans._auto_scc();
+
+    return ans;
+  }
 
-    return AlgCover(mgr(), nc, cap, body);
+  /// @brief 論理積を計算する(キューブ版)．
+  /// @return 計算結果を返す．
+  ///
+  /// 自身が右辺値の場合には自身の領域を使って計算する．
+  AlgCover
+  operator*(
+    const AlgCube& right ///< [in] オペランド
+  ) &&
+  {
+    operator*=(right);
+    return std::move(*this);
   }
 
   /// @brief 論理積を計算して代入する(キューブ版)．
@@ -452,9 +710,11 @@ public:
     ymuint64* old_body = mBody;
     resize(nc1 * nc2);
     mCubeNum = mgr().product(mBody, nc1, old_body, nc2, right.mBody);
+    _update_signature();
     if ( old_body != mBody ) {
-      mgr().delete_body(old_body, old_cap);
+      _delete_body(old_body, old_cap);
     }
+    _auto_scc();
 
     return *this;
   }
@@ -464,14 +724,29 @@ public:
   AlgCover
   operator*(
     AlgLiteral right ///< [in] オペランド
-  ) const
+  ) const &
   {
     SizeType nc1 = cube_num();
-    SizeType cap = get_capacity(nc1);
-    ymuint64* body = mgr().new_body(cap);
-    SizeType nc = mgr().product(body, nc1, mBody, right);
+    AlgCover ans{mgr(), 0, 0, nullptr};
+    ans.resize(nc1);
+    ans.mCubeNum = mgr().product(ans.mBody, nc1, mBody, right);
+    ans._inherit_signature(*this);
+    ans._auto_scc();
+
+    return ans;
+  }
 
-    return AlgCover(mgr(), nc, cap, body);
+  /// @brief 論理積を計算する(リテラル版)．
+  /// @return 計算結果を返す．
+  ///
+  /// 自身が右辺値の場合には自身の領域を使って計算する．
+  AlgCover
+  operator*(
+    AlgLiteral right ///< [in] オペランド
+  ) &&
+  {
+    operator*=(right);
+    return std::move(*this);
   }
 
   /// @brief 論理積を計算して代入する(リテラル版)．
@@ -482,6 +757,8 @@ public:
   )
   {
     mCubeNum = mgr().product(mBody, mCubeNum, mBody, right);
+    _update_signature();
+    _auto_scc();
 
     return *this;
   }
@@ -491,17 +768,58 @@ public:
   AlgCover
   operator/(
     const AlgCover& right ///< [in] オペランド
+  ) const &
+  {
+    ASSERT_COND( variable_num() == right.variable_num() );
+
+    SizeType nc1 = cube_num();
+    SizeType nc2 = right.cube_num();
+    AlgCover ans{mgr(), 0, 0, nullptr};
+    ans.resize(nc2 > 0 ? nc1 / nc2 : 0);
+    ans.mCubeNum = mgr().division(ans.mBody, nc1, mBody, nc2, right.mBody,
+				    _sig_body(), right._sig_body());
+    ans._inherit_signature(*this);
+
+    return ans;
+  }
+
+  /// @brief algebraic division の商と剰余を計算する．
+  /// @return 商と剰余のペアを返す．
+  ///
+  /// 自身 = 商 * right + 剰余 となる．
+  pair<AlgCover, AlgCover>
+  div_rem(
+    const AlgCover& right ///< [in] オペランド
   ) const
   {
     ASSERT_COND( variable_num() == right.variable_num() );
 
     SizeType nc1 = cube_num();
     SizeType nc2 = right.cube_num();
-    SizeType cap = get_capacity(nc1 / nc2);
-    ymuint64* body = mgr().new_body(cap);
-    SizeType nc = mgr().division(body, nc1, mBody, nc2, right.mBody);
+    AlgCover q{mgr(), 0, 0, nullptr};
+    q.resize(nc2 > 0 ? nc1 / nc2 : 0);
+    AlgCover r{mgr(), 0, 0, nullptr};
+    r.resize(nc1);
+    q.mCubeNum = mgr().division(q.mBody, r.mBody, r.mCubeNum,
+				nc1, mBody, nc2, right.mBody,
+				_sig_body(), right._sig_body());
+    q._inherit_signature(*this);
+    r._inherit_signature(*this);
+
+    return make_pair(std::move(q), std::move(r));
+  }
 
-    return AlgCover(mgr(), nc, cap, body);
+  /// @brief algebraic division を計算する．
+  /// @return 計算結果を返す．
+  ///
+  /// 自身が右辺値の場合には自身の領域を使って計算する．
+  AlgCover
+  operator/(
+    const AlgCover& right ///< [in] オペランド
+  ) &&
+  {
+    operator/=(right);
+    return std::move(*this);
   }
 
   /// @brief algebraic division を行って代入する．
@@ -516,7 +834,9 @@ public:
     SizeType nc1 = cube_num();
     SizeType nc2 = right.cube_num();
     // 結果のキューブ数は減るだけなのでキューブ容量は変更しない．
-    mCubeNum = mgr().division(mBody, nc1, mBody, nc2, right.mBody);
+    mCubeNum = mgr().division(mBody, nc1, mBody, nc2, right.mBody,
+			      _sig_body(), right._sig_body());
+    _update_signature();
 
     return *this;
   }
@@ -526,16 +846,31 @@ public:
   AlgCover
   operator/(
     const AlgCube& cube ///< [in] オペランド
-  ) const
+  ) const &
   {
     ASSERT_COND( variable_num() == cube.variable_num() );
 
     SizeType nc1 = cube_num();
-    SizeType cap = get_capacity(nc1);
-    ymuint64* body = mgr().new_body(cap);
-    SizeType nc = mgr().division(body, nc1, mBody, 1, cube.mBody);
+    AlgCover ans{mgr(), 0, 0, nullptr};
+    ans.resize(nc1);
+    ans.mCubeNum = mgr().division(ans.mBody, nc1, mBody, 1, cube.mBody,
+				    _sig_body());
+    ans._inherit_signature(*this);
 
-    return AlgCover(mgr(), nc, cap, body);
+    return ans;
+  }
+
+  /// @brief キューブによる商を計算する．
+  /// @return 計算結果を返す．
+  ///
+  /// 自身が右辺値の場合には自身の領域を使って計算する．
+  AlgCover
+  operator/(
+    const AlgCube& cube ///< [in] オペランド
+  ) &&
+  {
+    operator/=(cube);
+    return std::move(*this);
   }
 
   /// @brief キューブによる商を計算して代入する．
@@ -548,7 +883,9 @@ public:
     ASSERT_COND( variable_num() == cube.variable_num() );
 
     // 結果のキューブ数は減るだけなのでキューブ容量は変更しない．
-    mCubeNum = mgr().division(mBody, mCubeNum, mBody, 1, cube.mBody);
+    mCubeNum = mgr().division(mBody, mCubeNum, mBody, 1, cube.mBody,
+			      _sig_body());
+    _update_signature();
 
     return *this;
   }
@@ -558,14 +895,28 @@ public:
   AlgCover
   operator/(
     AlgLiteral lit ///< [in] オペランド
-  ) const
+  ) const &
   {
     SizeType nc1 = cube_num();
-    SizeType cap = get_capacity(nc1);
-    ymuint64* body = mgr().new_body(cap);
-    SizeType nc = mgr().division(body, nc1, mBody, lit);
+    AlgCover ans{mgr(), 0, 0, nullptr};
+    ans.resize(nc1);
+    ans.mCubeNum = mgr().division(ans.mBody, nc1, mBody, lit);
+    ans._inherit_signature(*this);
 
-    return AlgCover(mgr(), nc, cap, body);
+    return ans;
+  }
+
+  /// @brief リテラルによる商を計算する．
+  /// @return 計算結果を返す．
+  ///
+  /// 自身が右辺値の場合には自身の領域を使って計算する．
+  AlgCover
+  operator/(
+    AlgLiteral lit ///< [in] オペランド
+  ) &&
+  {
+    operator/=(lit);
+    return std::move(*this);
   }
 
   /// @brief リテラルによる商を計算して代入する．
@@ -577,6 +928,7 @@ public:
   {
     // 結果のキューブ数は減るだけなのでキューブ容量は変更しない．
     mCubeNum = mgr().division(mBody, mCubeNum, mBody, lit);
+    _update_signature();
 
     return *this;
   }
@@ -587,10 +939,10 @@ public:
   AlgCube
   common_cube() const
   {
-    ymuint64* body = mgr().new_body();
-    mgr().common_cube(body, cube_num(), mBody);
+    AlgCube ans{mgr()};
+    mgr().common_cube(ans.mBody, cube_num(), mBody);
 
-    return AlgCube(mgr(), body);
+    return ans;
   }
 
   /// @brief ハッシュ値を返す．
@@ -632,19 +984,107 @@ private:
 
   /// @brief キューブ容量を変更する．
   ///
-  /// 現在のキューブ容量が大きければ変更しない．
+  /// 現在のキューブ容量が大きければ変更しない．<br>
+  /// 内部の領域に収まる場合はそれを使う．<br>
+  /// 元の領域は解放しないので，必要なら呼び出し側で
+  /// _delete_body() を呼ぶこと．
   void
   resize(
     SizeType req_cap ///< [in] 要求するキューブ容量
   )
   {
-    SizeType new_cap = get_capacity(req_cap);
-    if ( new_cap > mCubeCap ) {
-      mCubeCap = new_cap;
+    if ( mBody != nullptr && req_cap <= mCubeCap ) {
+      return;
+    }
+    SizeType inline_cap = kInlineSize / mgr().cube_size();
+    if ( req_cap <= inline_cap && inline_cap > 0 ) {
+      for ( SizeType i = 0; i < kInlineSize; ++ i ) {
+	mInline[i] = 0ULL;
+      }
+      mCubeCap = inline_cap;
+      mBody = mInline;
+    }
+    else {
+      mCubeCap = get_capacity(req_cap);
       mBody = mgr().new_body(mCubeCap);
     }
   }
 
+  /// @brief 必要なら SCC 極小化を行う．
+  ///
+  /// 和と積の結果に対して用いる．
+  void
+  _auto_scc()
+  {
+    if ( mgr().auto_scc() ) {
+      make_scc_minimal();
+    }
+  }
+
+  /// @brief シグネチャを保持している時はその先頭を返す．
+  ///
+  /// 保持していない時は nullptr を返す．
+  const ymuint64*
+  _sig_body() const
+  {
+    return mUseSig ? mSigList.data() : nullptr;
+  }
+
+  /// @brief シグネチャを保持している時は計算し直す．
+  ///
+  /// 内容を変更した後に呼ぶこと．
+  void
+  _update_signature()
+  {
+    if ( mUseSig ) {
+      mSigList.resize(mCubeNum);
+      mgr().cube_signature(mSigList.data(), mCubeNum, mBody);
+    }
+  }
+
+  /// @brief src がシグネチャを保持していたら自身も保持する．
+  ///
+  /// 演算結果のカバーに対して内容を設定した後に呼ぶ．
+  void
+  _inherit_signature(
+    const AlgCover& src ///< [in] 演算の左辺
+  )
+  {
+    mUseSig = src.mUseSig;
+    _update_signature();
+  }
+
+  /// @brief resize() で確保した領域を解放する．
+  void
+  _delete_body(
+    ymuint64* body, ///< [in] 領域
+    SizeType cap    ///< [in] キューブ容量
+  )
+  {
+    if ( body != mInline ) {
+      mgr().delete_body(body, cap);
+    }
+  }
+
+  /// @brief 内部の領域を使っている時 true を返す．
+  bool
+  _is_inline() const
+  {
+    return mBody == mInline;
+  }
+
+  /// @brief src の内部の領域の内容をコピーして自身の内部の領域を使う．
+  void
+  _copy_inline(
+    const AlgCover& src ///< [in] コピー元のオブジェクト
+  )
+  {
+    for ( SizeType i = 0; i < kInlineSize; ++ i ) {
+      mInline[i] = src.mInline[i];
+    }
+    mBody = mInline;
+  }
+
   /// @brief キューブ容量を計算する．
   static
   SizeType
@@ -694,11 +1134,38 @@ private:
   // mBody の実際に確保されているキューブ容量
   SizeType mCubeCap{0};
 
+  // 内部の領域のワード数
+  static
+  constexpr SizeType kInlineSize = 4;
+
   // 内容を表すビットベクタ
+  // 内部の領域に収まる場合は mInline を指す．
   ymuint64* mBody{nullptr};
 
+  // 小さなカバー用の内部の領域
+  ymuint64 mInline[kInlineSize];
+
+  // キューブごとのシグネチャを保持する時 true にするフラグ
+  bool mUseSig{false};
+
+  // キューブごとのシグネチャ
+  // mUseSig が true の時は mCubeNum 個の要素を持つ．
+  vector<ymuint64> mSigList;
+
 };
 
+/// @relates AlgCover
+/// @brief 2つのカバーの内容を入れ替える．
+inline
+void
+swap(
+  AlgCover& left, ///< [in] 第1オペランド
+  AlgCover& right ///< [in] 第2オペランド
+) noexcept
+{
+  left.swap(right);
+}
+
 /// @relates AlgCover
 /// @brief 比較演算子 (EQ)
 /// @return 等しい時に true を返す．
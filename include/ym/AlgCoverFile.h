@@ -0,0 +1,164 @@
+#ifndef ALGCOVERFILE_H
+#define ALGCOVERFILE_H
+
+/// @file AlgCoverFile.h
+/// @brief AlgCoverFile のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/bfo_nsdef.h"
+#include "ym/AlgCover.h"
+#include "ym/AlgCoverView.h"
+#include "ym/AlgMgr.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgCoverFile AlgCoverFile.h "ym/AlgCoverFile.h"
+/// @brief カバーのリストを保存するバイナリファイルを扱うクラス
+///
+/// ファイルの構成は以下の通り．すべて 8 バイト境界に揃えてある．
+/// - ヘッダ: マジック，バージョン，エンディアン検査用の値，変数の数，
+///   カバー数，変数名領域のサイズ，チェックサム
+/// - 変数名: '\\0' で終端した文字列を並べたもの
+/// - カバーの表: カバーごとのキューブ数，フラグ(整列済みかどうか)，
+///   本体の先頭位置
+/// - 本体: AlgCover の本体のワード列をそのまま並べたもの
+///
+/// open() はファイルをメモリマップするだけで，本体はコピーせずに
+/// AlgCoverView として参照する．そのためチェックサムの検査は
+/// open() では行わず，必要なら verify() を呼ぶ．<br>
+/// 本体のワードはそのまま書き出すので，異なるエンディアンの
+/// 計算機で作られたファイルは開けない．
+//////////////////////////////////////////////////////////////////////
+class AlgCoverFile
+{
+public:
+
+  /// @brief コンストラクタ
+  AlgCoverFile();
+
+  /// @brief デストラクタ
+  ///
+  /// 開いているファイルは閉じられる．
+  ~AlgCoverFile();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief カバーのリストをファイルに書き出す．
+  /// @return 書き出しが成功したら true を返す．
+  ///
+  /// すべてのカバーは同じ AlgMgr に属していなければならない．
+  static
+  bool
+  write(
+    const string& filename,            ///< [in] ファイル名
+    const vector<AlgCover>& cover_list ///< [in] カバーのリスト
+  );
+
+  /// @brief ファイルを開く．
+  /// @return 成功したら true を返す．
+  ///
+  /// 前に開いていたファイルは閉じられる．
+  bool
+  open(
+    const string& filename ///< [in] ファイル名
+  );
+
+  /// @brief ファイルを閉じる．
+  ///
+  /// それまでに得た AlgCoverView は無効となる．
+  void
+  close();
+
+  /// @brief チェックサムを検査する．
+  /// @return 正しければ true を返す．
+  ///
+  /// ファイル全体を読むので時間がかかる．
+  bool
+  verify() const;
+
+  /// @brief マネージャを返す．
+  ///
+  /// open() が成功した後でのみ意味を持つ．
+  AlgMgr&
+  mgr() const
+  {
+    ASSERT_COND( mMgr != nullptr );
+
+    return *mMgr;
+  }
+
+  /// @brief カバー数を返す．
+  SizeType
+  cover_num() const
+  {
+    return mCoverNum;
+  }
+
+  /// @brief カバーを返す．
+  AlgCoverView
+  cover(
+    SizeType pos ///< [in] 位置番号 ( 0 <= pos < cover_num() )
+  ) const;
+
+  /// @brief エラーメッセージを返す．
+  const string&
+  error_message() const
+  {
+    return mErrorMessage;
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief エラーメッセージをセットしてファイルを閉じる．
+  /// @return 常に false を返す．
+  bool
+  _error(
+    const string& msg ///< [in] メッセージ
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // マップした領域の先頭
+  const ymuint64* mMap{nullptr};
+
+  // マップした領域のサイズ(バイト単位)
+  SizeType mMapSize{0};
+
+  // マネージャ
+  unique_ptr<AlgMgr> mMgr;
+
+  // カバー数
+  SizeType mCoverNum{0};
+
+  // カバーの表の先頭
+  const ymuint64* mCoverTable{nullptr};
+
+  // 本体の領域の先頭
+  const ymuint64* mBodyTop{nullptr};
+
+  // エラーメッセージ
+  string mErrorMessage;
+
+};
+
+END_NAMESPACE_YM_BFO
+
+#endif // ALGCOVERFILE_H
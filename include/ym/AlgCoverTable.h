@@ -0,0 +1,125 @@
+#ifndef ALGCOVERTABLE_H
+#define ALGCOVERTABLE_H
+
+/// @file AlgCoverTable.h
+/// @brief AlgCoverTable のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/bfo_nsdef.h"
+#include "ym/AlgCover.h"
+#include <memory>
+#include <unordered_map>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgCoverTable AlgCoverTable.h "ym/AlgCoverTable.h"
+/// @brief 同じ内容のカバーを1つに共有するためのテーブル
+///
+/// intern() は内容の等しいカバーが登録済みならそれを返し，
+/// そうでなければ新たに登録したものを返す．
+/// そのため同じ内容のカバーは同じポインタで表され，
+/// ポインタの比較で等価判定が行える．<br>
+/// テーブルは weak_ptr しか持たないので，参照がなくなった
+/// カバーは自動的に解放される．解放されたエントリは
+/// intern() のついでか purge() で取り除かれる．<br>
+/// 排他制御は行っていないので複数のスレッドから
+/// 同時に用いてはいけない．
+//////////////////////////////////////////////////////////////////////
+class AlgCoverTable
+{
+public:
+
+  /// @brief コンストラクタ
+  explicit
+  AlgCoverTable(
+    AlgMgr& mgr ///< [in] マネージャ
+  ) : mMgr{mgr}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~AlgCoverTable() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief マネージャを返す．
+  AlgMgr&
+  mgr() const
+  {
+    return mMgr;
+  }
+
+  /// @brief カバーを登録して共有されたものを返す．
+  std::shared_ptr<const AlgCover>
+  intern(
+    const AlgCover& cover ///< [in] 対象のカバー
+  );
+
+  /// @brief カバーを登録して共有されたものを返す．
+  ///
+  /// 新たに登録する場合は cover の領域を引き継ぐ．
+  std::shared_ptr<const AlgCover>
+  intern(
+    AlgCover&& cover ///< [in] 対象のカバー
+  );
+
+  /// @brief 参照の残っている登録済みのカバー数を返す．
+  SizeType
+  size() const;
+
+  /// @brief 参照のなくなったエントリを取り除く．
+  void
+  purge();
+
+  /// @brief すべてのエントリを取り除く．
+  ///
+  /// すでに返したカバーはそのまま使える．
+  void
+  clear()
+  {
+    mTable.clear();
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 登録済みのカバーを探す．
+  /// @return 見つからなければ nullptr を返す．
+  ///
+  /// 途中で見つけた参照のなくなったエントリは取り除く．
+  std::shared_ptr<const AlgCover>
+  _find(
+    SizeType h,           ///< [in] cover のハッシュ値
+    const AlgCover& cover ///< [in] 対象のカバー
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // マネージャ
+  AlgMgr& mMgr;
+
+  // ハッシュ値をキーにした表
+  std::unordered_multimap<SizeType, std::weak_ptr<const AlgCover>> mTable;
+
+};
+
+END_NAMESPACE_YM_BFO
+
+#endif // ALGCOVERTABLE_H
@@ -0,0 +1,220 @@
+#ifndef ALGCOVERVIEW_H
+#define ALGCOVERVIEW_H
+
+/// @file AlgCoverView.h
+/// @brief AlgCoverView のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/bfo_nsdef.h"
+#include "ym/AlgCover.h"
+#include "ym/AlgMgr.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgCoverView AlgCoverView.h "ym/AlgCoverView.h"
+/// @brief 他所が所有するビットベクタをカバーとして参照するクラス
+///
+/// AlgCover と同じレイアウトのビットベクタを指すだけで，
+/// 領域の確保も解放も行わない．<br>
+/// 主に AlgCoverFile でメモリマップしたファイル上のカバーを
+/// コピーせずに参照するために用いる．<br>
+/// 内容を書き換える演算は持たないので，必要な場合は to_cover() で
+/// AlgCover にコピーすること．
+//////////////////////////////////////////////////////////////////////
+class AlgCoverView
+{
+public:
+
+  /// @brief コンストラクタ
+  ///
+  /// body は cube_num * mgr.cube_size() ワードの領域を指していなければ
+  /// ならない．
+  AlgCoverView(
+    AlgMgr& mgr,           ///< [in] マネージャ
+    SizeType cube_num,     ///< [in] キューブ数
+    const ymuint64* body,  ///< [in] 本体
+    bool sorted = true     ///< [in] 整列済みの時 true
+  ) : mMgr{&mgr},
+      mCubeNum{cube_num},
+      mBody{body},
+      mSorted{sorted}
+  {
+  }
+
+  /// @brief AlgCover を参照するコンストラクタ
+  ///
+  /// cover が変更されたら無効となる．
+  explicit
+  AlgCoverView(
+    const AlgCover& cover ///< [in] 対象のカバー
+  ) : mMgr{&cover.mgr()},
+      mCubeNum{cover.cube_num()},
+      mBody{cover.mBody},
+      mSorted{true}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~AlgCoverView() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief マネージャを返す．
+  AlgMgr&
+  mgr() const
+  {
+    return *mMgr;
+  }
+
+  /// @brief 変数の数を返す．
+  SizeType
+  variable_num() const
+  {
+    return mMgr->variable_num();
+  }
+
+  /// @brief キューブの数を返す．
+  SizeType
+  cube_num() const
+  {
+    return mCubeNum;
+  }
+
+  /// @brief キューブが整列済みの時 true を返す．
+  bool
+  is_sorted() const
+  {
+    return mSorted;
+  }
+
+  /// @brief 本体のビットベクタを返す．
+  const ymuint64*
+  body() const
+  {
+    return mBody;
+  }
+
+  /// @brief リテラル数を返す．
+  SizeType
+  literal_num() const
+  {
+    return mMgr->literal_num(mCubeNum, mBody);
+  }
+
+  /// @brief 指定されたリテラルの出現回数を返す．
+  SizeType
+  literal_num(
+    AlgLiteral lit ///< [in] 対象のリテラル
+  ) const
+  {
+    return mMgr->literal_num(mCubeNum, mBody, lit);
+  }
+
+  /// @brief 全リテラルの出現回数を返す．
+  ///
+  /// 結果は AlgLiteral::index() でインデックスづけられた配列となる．
+  vector<SizeType>
+  literal_histogram() const
+  {
+    vector<SizeType> counts;
+    mMgr->literal_histogram(mCubeNum, mBody, counts);
+    return counts;
+  }
+
+  /// @brief 内容を AlgCover にコピーする．
+  ///
+  /// 整列済みでない場合は整列させる．
+  AlgCover
+  to_cover() const
+  {
+    AlgCover ans{*mMgr, 0, 0, nullptr};
+    ans.resize(mCubeNum);
+    mMgr->copy(mCubeNum, ans.mBody, 0, mBody, 0);
+    ans.mCubeNum = mCubeNum;
+    if ( !mSorted ) {
+      ans.mCubeNum = mMgr->sort(mCubeNum, ans.mBody);
+    }
+    return ans;
+  }
+
+  /// @brief ハッシュ値を返す．
+  ///
+  /// 同じ内容の AlgCover と同じ値となる．
+  SizeType
+  hash() const
+  {
+    return mMgr->hash(mCubeNum, mBody);
+  }
+
+  /// @brief 内容をわかりやすい形で出力する．
+  void
+  print(
+    ostream& s ///< [in] 出力先のストリーム
+  ) const
+  {
+    mMgr->print(s, mBody, 0, mCubeNum);
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // マネージャ
+  AlgMgr* mMgr;
+
+  // キューブ数
+  SizeType mCubeNum;
+
+  // 本体
+  const ymuint64* mBody;
+
+  // 整列済みの時 true
+  bool mSorted;
+
+};
+
+/// @relates AlgCoverView
+/// @brief AlgCover との等価比較演算子
+///
+/// 整列済みでない場合の結果は保証されない．
+inline
+bool
+operator==(
+  const AlgCoverView& left, ///< [in] 第1オペランド
+  const AlgCover& right     ///< [in] 第2オペランド
+)
+{
+  ASSERT_COND( &left.mgr() == &right.mgr() );
+
+  return left.mgr().compare(left.cube_num(), left.body(),
+			    right.cube_num(), AlgCoverView{right}.body()) == 0;
+}
+
+/// @relates AlgCoverView
+/// @brief ストリーム出力演算子
+inline
+ostream&
+operator<<(
+  ostream& s,               ///< [in] 出力先のストリーム
+  const AlgCoverView& cover ///< [in] 対象のカバー
+)
+{
+  cover.print(s);
+  return s;
+}
+
+END_NAMESPACE_YM_BFO
+
+#endif // ALGCOVERVIEW_H
@@ -39,7 +39,7 @@ public:
     AlgMgr& mgr,   ///< [in] マネージャ
     AlgLiteral lit ///< [in] リテラル
   ) : mMgr{&mgr},
-      mBody{mMgr->new_body()}
+      mBody{_new_body()}
   {
     // わざわざ vector<AlgLiteral> を作っているので
     // あまり効率はよくなけど，AlgMgr に別の関数を
@@ -55,7 +55,7 @@ public:
     AlgMgr& mgr,                            ///< [in] マネージャ
     const vector<AlgLiteral>& lit_list = {} ///< [in] キューブを表すリテラルのリスト
   ) : mMgr{&mgr},
-      mBody{mMgr->new_body()}
+      mBody{_new_body()}
   {
     mMgr->set_literal(mBody, 0, lit_list);
   }
@@ -66,41 +66,17 @@ public:
   /// 否定の場合は ' を変数名の直後につける．変数名と'の間の空白は認めない<br>
   /// 文字列が不正だった場合には空のキューブとなる．
   AlgCube(
-    AlgMgr& mgr,    ///< [in] マネージャ
-    const char* str ///< [in] 内容を表す文字列
+    AlgMgr& mgr,         ///< [in] マネージャ
+    std::string_view str ///< [in] 内容を表す文字列
   ) : mMgr{&mgr},
-      mBody{mMgr->new_body()}
+      mBody{_new_body()}
   {
-    vector<AlgLiteral> lit_list;
-    SizeType n = mMgr->parse(str, lit_list);
-    if ( n == 1 ) {
-      mMgr->set_literal(mBody, 0, lit_list);
-    }
-    else {
-      // 複数のキューブを表す文字列だった．
-      // 無視する．
-    }
-  }
-
-  /// @brief コンストラクタ
-  ///
-  /// 文字列は mgr の varname() を空白で区切ったもの<br>
-  /// 否定の場合は ' を変数名の直後につける．変数名と'の間の空白は認めない<br>
-  /// 文字列が不正だった場合には空のキューブとなる．
-  AlgCube(
-    AlgMgr& mgr,      ///< [in] マネージャ
-    const string& str ///< [in] 内容を表す文字列
-  ) : mMgr{&mgr},
-      mBody{mMgr->new_body()}
-  {
-    vector<AlgLiteral> lit_list;
-    SizeType n = mMgr->parse(str.c_str(), lit_list);
-    if ( n == 1 ) {
-      mMgr->set_literal(mBody, 0, lit_list);
-    }
-    else {
-      // 複数のキューブを表す文字列だった．
-      // 無視する．
+    // 複数のキューブを表す文字列だった場合は無視する．
+    if ( AlgMgr::parse_cube_num(str) == 1 ) {
+      SizeType err_pos;
+      if ( mMgr->parse(str, mBody, err_pos) != 1 ) {
+	mMgr->cube_clear(mBody, 0);
+      }
     }
   }
 
@@ -108,24 +84,42 @@ public:
   AlgCube(
     const AlgCube& src ///< [in] コピー元のオブジェクト
   ) : mMgr{src.mMgr},
-      mBody{mMgr->new_body()}
+      mBody{_new_body()}
   {
     mMgr->cube_copy(mBody, 0, src.mBody, 0);
   }
 
+  /// @brief ムーブコンストラクタ
+  ///
+  /// src の領域を引き継ぐ．
+  /// 内部の領域を使っている場合は内容をコピーする．<br>
+  /// ムーブ後の src は代入とデストラクタ以外の操作はできない．
+  AlgCube(
+    AlgCube&& src ///< [in] ムーブ元のオブジェクト
+  ) noexcept : mMgr{src.mMgr},
+	       mBody{src.mBody}
+  {
+    if ( src._is_inline() ) {
+      _copy_inline(src);
+    }
+    else {
+      src.mBody = nullptr;
+    }
+  }
+
   /// @brief 代入演算子
   /// @return 代入後の自身への参照を返す．
-  const AlgCube&
+  AlgCube&
   operator=(
     const AlgCube& src ///< [in] コピー元のオブジェクト
   )
   {
     if ( &src != this ) {
-      if ( &mMgr != &src.mMgr ) {
+      if ( mMgr != src.mMgr || mBody == nullptr ) {
 	// マネージャが異なっていたら mBody を作り直す．
-	mMgr->delete_body(mBody);
+	_delete_body();
 	mMgr = src.mMgr;
-	mBody = mMgr->new_body();
+	mBody = _new_body();
       }
       else {
 	// マネージャが同じなら mBody は使いまわす．
@@ -136,10 +130,24 @@ public:
     return *this;
   }
 
+  /// @brief ムーブ代入演算子
+  /// @return 代入後の自身への参照を返す．
+  ///
+  /// src には自身の元の内容が入る．
+  AlgCube&
+  operator=(
+    AlgCube&& src ///< [in] ムーブ元のオブジェクト
+  ) noexcept
+  {
+    swap(src);
+
+    return *this;
+  }
+
   /// @brief デストラクタ
   ~AlgCube()
   {
-    mMgr->delete_body(mBody);
+    _delete_body();
   }
 
 
@@ -148,6 +156,31 @@ public:
   // 外部インターフェイス
   //////////////////////////////////////////////////////////////////////
 
+  /// @brief 内容を入れ替える．
+  void
+  swap(
+    AlgCube& right ///< [in] 入れ替える相手
+  ) noexcept
+  {
+    std::swap(mMgr, right.mMgr);
+    bool inline1 = _is_inline();
+    bool inline2 = right._is_inline();
+    if ( inline1 && inline2 ) {
+      std::swap(mInline, right.mInline);
+    }
+    else if ( inline1 ) {
+      mBody = right.mBody;
+      right._copy_inline(*this);
+    }
+    else if ( inline2 ) {
+      right.mBody = mBody;
+      _copy_inline(right);
+    }
+    else {
+      std::swap(mBody, right.mBody);
+    }
+  }
+
   /// @brief マネージャを返す．
   AlgMgr&
   mgr() const
@@ -230,7 +263,7 @@ public:
   ///
   /// リテラル集合とみなすとユニオンを計算することになる<br>
   /// ただし，相反するリテラルとの積があったら答は空のキューブとなる．
-  const AlgCube&
+  AlgCube&
   operator*=(
     const AlgCube& right ///< [in] オペランドのキューブ
   )
@@ -250,7 +283,7 @@ public:
   ///
   /// リテラル集合とみなすとユニオンを計算することになる<br>
   /// ただし，相反するリテラルとの積があったら答は空のキューブとなる．
-  const AlgCube&
+  AlgCube&
   operator*=(
     AlgLiteral right ///< [in] オペランドのリテラル
   )
@@ -268,7 +301,7 @@ public:
   ///
   /// リテラル集合として考えると集合差を計算することになる<br>
   /// ただし，right のみに含まれるリテラルがあったら結果は空となる．
-  const AlgCube&
+  AlgCube&
   operator/=(
     const AlgCube& right ///< [in] オペランドのキューブ
   )
@@ -288,7 +321,7 @@ public:
   ///
   /// リテラル集合として考えると集合差を計算することになる<br>
   /// ただし，right のみに含まれるリテラルがあったら結果は空となる．
-  const AlgCube&
+  AlgCube&
   operator/=(
     AlgLiteral right ///< [in] オペランドのリテラル
   )
@@ -334,6 +367,50 @@ private:
   {
   }
 
+  /// @brief 本体の領域を確保する．
+  ///
+  /// 内部の領域に収まる場合はそれを使う．<br>
+  /// どちらの場合も内容は 0 に初期化されている．
+  ymuint64*
+  _new_body()
+  {
+    if ( mMgr->cube_size() <= kInlineSize ) {
+      for ( SizeType i = 0; i < kInlineSize; ++ i ) {
+	mInline[i] = 0ULL;
+      }
+      return mInline;
+    }
+    return mMgr->new_body();
+  }
+
+  /// @brief 本体の領域を解放する．
+  void
+  _delete_body()
+  {
+    if ( !_is_inline() ) {
+      mMgr->delete_body(mBody);
+    }
+  }
+
+  /// @brief 内部の領域を使っている時 true を返す．
+  bool
+  _is_inline() const
+  {
+    return mBody == mInline;
+  }
+
+  /// @brief src の内部の領域の内容をコピーして自身の内部の領域を使う．
+  void
+  _copy_inline(
+    const AlgCube& src ///< [in] コピー元のオブジェクト
+  )
+  {
+    for ( SizeType i = 0; i < kInlineSize; ++ i ) {
+      mInline[i] = src.mInline[i];
+    }
+    mBody = mInline;
+  }
+
   // friend 関数の宣言
   friend
   int
@@ -351,9 +428,17 @@ private:
   // マネージャ
   AlgMgr* mMgr;
 
+  // 内部の領域のワード数
+  static
+  constexpr SizeType kInlineSize = 2;
+
   // 内容を表すビットベクタ
+  // 内部の領域に収まる場合は mInline を指す．
   ymuint64* mBody;
 
+  // 小さなキューブ用の内部の領域
+  ymuint64 mInline[kInlineSize];
+
 };
 
 /// @relates AlgCube
@@ -368,7 +453,24 @@ operator*(
   const AlgCube& right ///< [in] 第2オペランド
 )
 {
-  return AlgCube(left).operator*=(right);
+  AlgCube ans{left};
+  ans *= right;
+  return ans;
+}
+
+/// @relates AlgCube
+/// @brief キューブの論理積を計算する
+///
+/// left が右辺値の場合には left の領域を使って計算する．
+inline
+AlgCube
+operator*(
+  AlgCube&& left,      ///< [in] 第1オペランド
+  const AlgCube& right ///< [in] 第2オペランド
+)
+{
+  left *= right;
+  return std::move(left);
 }
 
 /// @relates AlgCube
@@ -383,7 +485,24 @@ operator*(
   AlgLiteral right     ///< [in] 第2オペランド
 )
 {
-  return AlgCube(left).operator*=(right);
+  AlgCube ans{left};
+  ans *= right;
+  return ans;
+}
+
+/// @relates AlgCube
+/// @brief キューブとリテラルの論理積を計算する
+///
+/// left が右辺値の場合には left の領域を使って計算する．
+inline
+AlgCube
+operator*(
+  AlgCube&& left,  ///< [in] 第1オペランド
+  AlgLiteral right ///< [in] 第2オペランド
+)
+{
+  left *= right;
+  return std::move(left);
 }
 
 /// @relates AlgCube
@@ -395,7 +514,24 @@ operator/(
   const AlgCube& right ///< [in] 第2オペランド
 )
 {
-  return AlgCube(left).operator/=(right);
+  AlgCube ans{left};
+  ans /= right;
+  return ans;
+}
+
+/// @relates AlgCube
+/// @brief キューブによる商を計算する
+///
+/// left が右辺値の場合には left の領域を使って計算する．
+inline
+AlgCube
+operator/(
+  AlgCube&& left,      ///< [in] 第1オペランド
+  const AlgCube& right ///< [in] 第2オペランド
+)
+{
+  left /= right;
+  return std::move(left);
 }
 
 /// @relates AlgCube
@@ -407,7 +543,36 @@ operator/(
   AlgLiteral right     ///< [in] 第2オペランド
 )
 {
-  return AlgCube(left).operator/=(right);
+  AlgCube ans{left};
+  ans /= right;
+  return ans;
+}
+
+/// @relates AlgCube
+/// @brief リテラルによる商を計算する
+///
+/// left が右辺値の場合には left の領域を使って計算する．
+inline
+AlgCube
+operator/(
+  AlgCube&& left,  ///< [in] 第1オペランド
+  AlgLiteral right ///< [in] 第2オペランド
+)
+{
+  left /= right;
+  return std::move(left);
+}
+
+/// @relates AlgCube
+/// @brief 2つのキューブの内容を入れ替える．
+inline
+void
+swap(
+  AlgCube& left, ///< [in] 第1オペランド
+  AlgCube& right ///< [in] 第2オペランド
+) noexcept
+{
+  left.swap(right);
 }
 
 /// @relates AlgCube
@@ -0,0 +1,233 @@
+#ifndef ALGEXPR_H
+#define ALGEXPR_H
+
+/// @file AlgExpr.h
+/// @brief AlgExpr のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/bfo_nsdef.h"
+#include "ym/AlgLiteral.h"
+#include <memory>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgExpr AlgExpr.h "ym/AlgExpr.h"
+/// @brief ファクタードフォームを表す論理式
+///
+/// 定数，リテラル，AND，OR の木で表す．
+/// 内容は変更できないのでコピーしても木は共有される．<br>
+/// AND/OR の演算では同じ種類の子供は平坦化され，
+/// 定数は取り除かれる．
+//////////////////////////////////////////////////////////////////////
+class AlgExpr
+{
+public:
+
+  /// @brief 空のコンストラクタ
+  ///
+  /// 定数0となる．
+  AlgExpr();
+
+  /// @brief デストラクタ
+  ~AlgExpr() = default;
+
+  /// @brief 定数0を作る．
+  static
+  AlgExpr
+  zero();
+
+  /// @brief 定数1を作る．
+  static
+  AlgExpr
+  one();
+
+  /// @brief リテラルを作る．
+  static
+  AlgExpr
+  literal(
+    AlgLiteral lit ///< [in] リテラル
+  );
+
+  /// @brief 論理積を作る．
+  ///
+  /// opr_list が空の時は定数1となる．
+  static
+  AlgExpr
+  and_op(
+    const vector<AlgExpr>& opr_list ///< [in] オペランドのリスト
+  )
+  {
+    return _make_op(true, opr_list);
+  }
+
+  /// @brief 論理和を作る．
+  ///
+  /// opr_list が空の時は定数0となる．
+  static
+  AlgExpr
+  or_op(
+    const vector<AlgExpr>& opr_list ///< [in] オペランドのリスト
+  )
+  {
+    return _make_op(false, opr_list);
+  }
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 定数0の時 true を返す．
+  bool
+  is_zero() const;
+
+  /// @brief 定数1の時 true を返す．
+  bool
+  is_one() const;
+
+  /// @brief リテラルの時 true を返す．
+  bool
+  is_literal() const;
+
+  /// @brief AND の時 true を返す．
+  bool
+  is_and() const;
+
+  /// @brief OR の時 true を返す．
+  bool
+  is_or() const;
+
+  /// @brief リテラルを返す．
+  ///
+  /// is_literal() が true の時のみ意味を持つ．
+  AlgLiteral
+  literal() const;
+
+  /// @brief オペランドのリストを返す．
+  ///
+  /// is_and() か is_or() が true の時のみ意味を持つ．
+  const vector<AlgExpr>&
+  operand_list() const;
+
+  /// @brief リテラル数を返す．
+  ///
+  /// 共有されている部分木も出現するたびに数える．
+  SizeType
+  literal_num() const;
+
+  /// @brief 積和形に展開したカバーを返す．
+  ///
+  /// 展開は algebraic な積と和で行う．
+  AlgCover
+  to_cover(
+    AlgMgr& mgr ///< [in] マネージャ
+  ) const;
+
+  /// @brief 内容をわかりやすい形で出力する．
+  ///
+  /// 変数名には mgr の変数名を用いる．
+  void
+  print(
+    ostream& s,        ///< [in] 出力先のストリーム
+    const AlgMgr& mgr  ///< [in] マネージャ
+  ) const;
+
+  /// @brief 論理積を返す．
+  AlgExpr
+  operator&(
+    const AlgExpr& right ///< [in] オペランド
+  ) const
+  {
+    return _make_op(true, {*this, right});
+  }
+
+  /// @brief 論理和を返す．
+  AlgExpr
+  operator|(
+    const AlgExpr& right ///< [in] オペランド
+  ) const
+  {
+    return _make_op(false, {*this, right});
+  }
+
+  /// @brief 構造が等しい時 true を返す．
+  ///
+  /// オペランドの順序も区別する．
+  bool
+  operator==(
+    const AlgExpr& right ///< [in] オペランド
+  ) const;
+
+  /// @brief 構造が異なる時 true を返す．
+  bool
+  operator!=(
+    const AlgExpr& right ///< [in] オペランド
+  ) const
+  {
+    return !operator==(right);
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  struct Node;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ノードを指定したコンストラクタ
+  explicit
+  AlgExpr(
+    std::shared_ptr<const Node> node ///< [in] ノード
+  ) : mNode{std::move(node)}
+  {
+  }
+
+  /// @brief AND/OR を作る．
+  ///
+  /// 定数の処理と同じ種類の子供の平坦化を行う．
+  static
+  AlgExpr
+  _make_op(
+    bool is_and,                    ///< [in] AND の時 true
+    const vector<AlgExpr>& opr_list ///< [in] オペランドのリスト
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // ノード
+  std::shared_ptr<const Node> mNode;
+
+};
+
+/// @relates AlgExpr
+/// @brief AlgExpr の内容を出力する．
+/// @return ストリームを返す．
+///
+/// 変数名は v_<変数番号> となる．
+ostream&
+operator<<(
+  ostream& s,         ///< [in] 出力先のストリーム
+  const AlgExpr& expr ///< [in] 対象の論理式
+);
+
+END_NAMESPACE_YM_BFO
+
+#endif // ALGEXPR_H
@@ -0,0 +1,172 @@
+#ifndef ALGFACTORGEN_H
+#define ALGFACTORGEN_H
+
+/// @file AlgFactorGen.h
+/// @brief AlgFactorGen のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2017, 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/bfo_nsdef.h"
+#include "ym/AlgCover.h"
+#include "ym/AlgExpr.h"
+#include "ym/AlgKernelGen.h"
+#include <unordered_map>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+/// @brief ファクタリングの方法を表す列挙型
+enum AlgFactorMode {
+  /// @brief レベル0カーネルを除数とする (quick factor)
+  kAlgFactorQuick,
+  /// @brief 最も効果の大きいカーネルを除数とする (good factor)
+  kAlgFactorGood,
+  /// @brief 最も出現頻度の高いリテラルで括りだす (literal factor)
+  kAlgFactorLiteral,
+};
+
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgFactorGen AlgFactorGen.h "ym/AlgFactorGen.h"
+/// @brief カバーをファクタリングして AlgExpr を作るクラス
+///
+/// 除数 d を選んで f = d * q + r と分解し，d, q, r を再帰的に
+/// ファクタリングする．除数の選び方は AlgFactorMode で指定する．<br>
+/// 各部分カバーの結果はカバーをキーにして記憶しておくので，
+/// 同じ部分カバーが何度現れても1度しかファクタリングしない．
+/// 記憶した結果は clear() を呼ぶまで，複数の factor() の呼び出しに
+/// またがって共有される．<br>
+/// 分解は algebraic な演算のみで行うので，結果を
+/// AlgExpr::to_cover() で展開すると元のカバーに戻る．
+//////////////////////////////////////////////////////////////////////
+class AlgFactorGen
+{
+public:
+
+  /// @brief コンストラクタ
+  explicit
+  AlgFactorGen(
+    AlgFactorMode mode = kAlgFactorQuick ///< [in] ファクタリングの方法
+  ) : mMode{mode}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~AlgFactorGen() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ファクタリングの方法を返す．
+  AlgFactorMode
+  mode() const
+  {
+    return mMode;
+  }
+
+  /// @brief ファクタリングの方法を設定する．
+  ///
+  /// 記憶している結果は破棄される．
+  void
+  set_mode(
+    AlgFactorMode mode ///< [in] ファクタリングの方法
+  )
+  {
+    if ( mMode != mode ) {
+      mMode = mode;
+      clear();
+    }
+  }
+
+  /// @brief ファクタリングを行う．
+  /// @return 結果の論理式を返す．
+  AlgExpr
+  factor(
+    const AlgCover& cover ///< [in] 対象のカバー
+  );
+
+  /// @brief 記憶している結果の数を返す．
+  SizeType
+  memo_size() const
+  {
+    return mMemo.size();
+  }
+
+  /// @brief 記憶している結果を破棄する．
+  ///
+  /// 異なる AlgMgr のカバーを扱う前には呼ばなければならない．
+  void
+  clear()
+  {
+    mMemo.clear();
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 除数を選ぶ．
+  /// @return 除数を返す．
+  ///
+  /// 適当な除数がない場合には空のカバーを返す．
+  AlgCover
+  _divisor(
+    const AlgCover& cover ///< [in] 対象のカバー
+  );
+
+  /// @brief リテラルで括りだす．
+  ///
+  /// cover = lit * q + r として q と r を再帰的にファクタリングする．
+  AlgExpr
+  _literal_factor(
+    const AlgCover& cover, ///< [in] 対象のカバー
+    AlgLiteral lit         ///< [in] 括りだすリテラル
+  );
+
+  /// @brief キューブ中で最も出現頻度の高いリテラルを選ぶ．
+  ///
+  /// cube が nullptr の時は全リテラルから選ぶ．
+  /// 出現頻度が2以上のリテラルがない時は AlgLiteralUndef を返す．
+  static
+  AlgLiteral
+  _best_literal(
+    const AlgCover& cover,          ///< [in] 対象のカバー
+    const AlgCube* cube = nullptr   ///< [in] リテラルを選ぶキューブ
+  );
+
+  /// @brief カバーをそのまま積和形の論理式にする．
+  static
+  AlgExpr
+  _sop_expr(
+    const AlgCover& cover ///< [in] 対象のカバー
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // ファクタリングの方法
+  AlgFactorMode mMode;
+
+  // kAlgFactorGood で用いるカーネル生成器
+  // 再帰の各段で作り直さないように持っておく．
+  AlgKernelGen mKernelGen;
+
+  // カバーをキーにして結果を記憶する表
+  std::unordered_map<AlgCover, AlgExpr> mMemo;
+
+};
+
+END_NAMESPACE_YM_BFO
+
+#endif // ALGFACTORGEN_H
@@ -0,0 +1,243 @@
+#ifndef ALGFASTEXTRACT_H
+#define ALGFASTEXTRACT_H
+
+/// @file AlgFastExtract.h
+/// @brief AlgFastExtract のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/bfo_nsdef.h"
+#include "ym/AlgCover.h"
+#include <limits>
+#include <queue>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgFxStep AlgFastExtract.h "ym/AlgFastExtract.h"
+/// @brief AlgFastExtract の1ステップの結果を表す構造体
+//////////////////////////////////////////////////////////////////////
+struct AlgFxStep
+{
+  /// @brief 新しいノードに割り当てた変数番号
+  SizeType var_id;
+
+  /// @brief 括りだした除数
+  AlgCover divisor;
+
+  /// @brief 単一キューブの除数の時 true
+  bool single_cube;
+
+  /// @brief 削減されたリテラル数
+  ///
+  /// 新しいノードのリテラル数も考慮した値
+  int saving;
+
+  /// @brief このステップ後の総リテラル数
+  SizeType literal_num;
+
+};
+
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgFastExtract AlgFastExtract.h "ym/AlgFastExtract.h"
+/// @brief fast extract (FX) 方式で共通の除数を括りだすクラス
+///
+/// 同じ AlgMgr に属するカバーの集合を対象とする．<br>
+/// 2キューブの除数(double-cube divisor)と2リテラルの単一キューブの除数
+/// (single-cube divisor)をハッシュ表で列挙し，その重み(括りだした時に
+/// 削減されるリテラル数)を優先度付きキューで管理する．<br>
+/// 除数を括りだした後は変化したカバーの分だけ重みを更新する．<br>
+/// 新しいノードの変数には，どのカバーにも現れない変数を番号の小さい
+/// 順に割り当てる．空いている変数がなくなった時点で処理を終える．
+//////////////////////////////////////////////////////////////////////
+class AlgFastExtract
+{
+public:
+
+  /// @brief コンストラクタ
+  AlgFastExtract(
+    AlgMgr& mgr ///< [in] マネージャ
+  );
+
+  /// @brief デストラクタ
+  ~AlgFastExtract();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 除数の括りだしを行う．
+  /// @return 各ステップの結果のリストを返す．
+  ///
+  /// cover_list の内容は括りだした後のものに置き換えられる．<br>
+  /// 括りだした除数は新しいノードとして cover_list の末尾に追加される．
+  /// つまり k 番目のステップの除数は
+  /// cover_list[元のカバー数 + k] となる．
+  vector<AlgFxStep>
+  extract(
+    vector<AlgCover>& cover_list, ///< [inout] 対象のカバーのリスト
+    SizeType max_step = std::numeric_limits<SizeType>::max()
+                                  ///< [in] 最大ステップ数
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  // 除数の情報
+  struct Divisor
+  {
+    // 除数を表すビットベクタ
+    // 2キューブの除数の場合は cube_compare() の降順に並べる．
+    vector<ymuint64> mKey;
+
+    // 単一キューブの除数の時 true
+    bool mSingle;
+
+    // 除数のリテラル数
+    int mLitNum;
+
+    // 出現回数
+    int mOccNum{0};
+
+    // 出現箇所の共通キューブのリテラル数の和
+    int mBaseSum{0};
+
+    // 優先度付きキューの要素と照合するためのスタンプ
+    SizeType mStamp{0};
+
+    // 更新リストに入っている時 true
+    bool mDirty{false};
+
+    // 重み(削減されるリテラル数の見積もり)
+    int
+    weight() const
+    {
+      if ( mSingle ) {
+	// k 個のキューブの2リテラルが1リテラルになり，
+	// 2リテラルのノードが増える．
+	return mOccNum - 2;
+      }
+      // 2つのキューブ (b d1 + b d2) が b x になり，
+      // mLitNum リテラルのノードが増える．
+      return mBaseSum + mOccNum * (mLitNum - 1) - mLitNum;
+    }
+  };
+
+  // 優先度付きキューの要素
+  struct HeapEntry
+  {
+    // 重み
+    int mWeight;
+
+    // 除数番号
+    SizeType mId;
+
+    // スタンプ
+    SizeType mStamp;
+
+    // 比較関数
+    // 重みが同じ場合は番号の小さい方を優先する．
+    bool
+    operator<(
+      const HeapEntry& right
+    ) const
+    {
+      if ( mWeight != right.mWeight ) {
+	return mWeight < right.mWeight;
+      }
+      return mId > right.mId;
+    }
+  };
+
+  // mKey 用のハッシュ関数
+  struct KeyHash
+  {
+    SizeType
+    operator()(
+      const vector<ymuint64>& key
+    ) const;
+  };
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief カバーに含まれる除数を数える．
+  ///
+  /// sign が -1 の時は取り除く．
+  void
+  _scan(
+    const AlgCover& cover, ///< [in] 対象のカバー
+    int sign               ///< [in] 1 か -1
+  );
+
+  /// @brief 除数の出現を登録する．
+  void
+  _count(
+    const vector<ymuint64>& key, ///< [in] 除数を表すビットベクタ
+    bool single,                 ///< [in] 単一キューブの除数の時 true
+    int lit_num,                 ///< [in] 除数のリテラル数
+    int base_num,                ///< [in] 共通キューブのリテラル数
+    int sign                     ///< [in] 1 か -1
+  );
+
+  /// @brief 更新された除数を優先度付きキューに積む．
+  void
+  _flush();
+
+  /// @brief 最も重みの大きな除数を取り出す．
+  /// @return 重みが正の除数がなければ false を返す．
+  bool
+  _pop(
+    SizeType& id ///< [out] 除数番号
+  );
+
+  /// @brief ビットベクタからカバーを作る．
+  AlgCover
+  _make_cover(
+    const ymuint64* bv, ///< [in] ビットベクタ
+    SizeType cube_num   ///< [in] キューブ数
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // マネージャ
+  AlgMgr& mMgr;
+
+  // 1キューブのワード数
+  SizeType mCubeSize;
+
+  // 除数のリスト
+  vector<Divisor> mDivList;
+
+  // 除数を表すビットベクタをキーにして番号を保持するハッシュ表
+  unordered_map<vector<ymuint64>, SizeType, KeyHash> mDivHash;
+
+  // 重みの降順に除数番号を取り出す優先度付きキュー
+  // 重みが変わった時は新しい要素を積み，古い要素は取り出した時に捨てる．
+  std::priority_queue<HeapEntry> mHeap;
+
+  // 重みが変化した除数番号のリスト
+  vector<SizeType> mDirtyList;
+
+};
+
+END_NAMESPACE_YM_BFO
+
+#endif // ALGFASTEXTRACT_H
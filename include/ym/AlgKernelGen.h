@@ -5,23 +5,43 @@
 /// @brief AlgKernelGen のヘッダファイル
 /// @author Yusuke Matsunaga (松永 裕介)
 ///
-/// Copyright (C) 2017 Yusuke Matsunaga
+/// Copyright (C) 2017, 2022 Yusuke Matsunaga
 /// All rights reserved.
 
 
 #include "ym/bfo_nsdef.h"
 #include "ym/AlgCover.h"
+#include "ym/AlgLitSet.h"
 
 
 BEGIN_NAMESPACE_YM_BFO
 
+class AlgTaskPool;
+
 //////////////////////////////////////////////////////////////////////
 /// @class カーネル(とコカーネル)の情報を表す構造体
 //////////////////////////////////////////////////////////////////////
 struct AlgKernelInfo
 {
   /// @brief 空のコンストラクタ
-  AlgKernelInfo(AlgMgr& mgr);
+  AlgKernelInfo(
+    AlgMgr& mgr ///< [in] マネージャ
+  ) : mKernel{mgr},
+      mCoKernel{mgr},
+      mLevel{0}
+  {
+  }
+
+  /// @brief 内容を指定したコンストラクタ
+  AlgKernelInfo(
+    AlgCover&& kernel,   ///< [in] カーネル
+    AlgCover&& cokernel, ///< [in] コカーネルの集合
+    ymuint level         ///< [in] レベル
+  ) : mKernel{std::move(kernel)},
+      mCoKernel{std::move(cokernel)},
+      mLevel{level}
+  {
+  }
 
   /// @brief カーネル
   AlgCover mKernel;
@@ -32,6 +52,8 @@ struct AlgKernelInfo
   AlgCover mCoKernel;
 
   /// @brief カーネルのレベル
+  ///
+  /// 自分以外のカーネルを含まないカーネルのレベルが 0 となる．
   ymuint mLevel;
 
 };
@@ -40,13 +62,23 @@ struct AlgKernelInfo
 //////////////////////////////////////////////////////////////////////
 /// @class AlgKernelGen AlgKernelGen.h "AlgKernelGen.h"
 /// @brief カーネルを求めるクラス
+///
+/// リテラルごとの再帰的な分岐を work-stealing 方式のスレッドプール
+/// 上のタスクとして並列に処理する．
+/// スレッド数が1の時はスレッドを作らずに呼び出したスレッドで処理する．<br>
+/// スレッドプールは最初の generate() で作られ，set_thread_num() で
+/// スレッド数が変わるまで使い回される．<br>
+/// 結果はスレッドの実行順序に依らずに同じになる．
 //////////////////////////////////////////////////////////////////////
 class AlgKernelGen
 {
 public:
 
   /// @brief コンストラクタ
-  AlgKernelGen();
+  explicit
+  AlgKernelGen(
+    SizeType thread_num = 1 ///< [in] スレッド数
+  );
 
   /// @brief デストラクタ
   ~AlgKernelGen();
@@ -57,12 +89,38 @@ public:
   // 外部インターフェイス
   //////////////////////////////////////////////////////////////////////
 
+  /// @brief スレッド数を返す．
+  SizeType
+  thread_num() const
+  {
+    return mThreadNum;
+  }
+
+  /// @brief スレッド数を設定する．
+  ///
+  /// スレッド数が変わった場合はスレッドプールを作り直す．
+  void
+  set_thread_num(
+    SizeType thread_num ///< [in] スレッド数
+  );
+
   /// @brief カーネルとコカーネルを列挙する．
-  /// @param[in] cover 対象のカバー
-  /// @param[out] kernel_list 結果を格納するリスト
+  ///
+  /// kernel_list はカーネルの昇順に整列している．
   void
-  generate(const AlgCover& cover,
-	   vector<AlgKernelInfo>& kernel_list);
+  generate(
+    const AlgCover& cover,             ///< [in] 対象のカバー
+    vector<AlgKernelInfo>& kernel_list ///< [out] 結果を格納するリスト
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  class KernelTable;
+  class Context;
 
 
 private:
@@ -71,16 +129,17 @@ private:
   //////////////////////////////////////////////////////////////////////
 
   /// @brief カーネルを求める下請け関数
-  /// @param[in] cover 対象のカバー
-  /// @param[in] pos mLitList 上の位置
-  /// @param[in] ccube 今までに括りだされた共通のキューブ
-  /// @param[in] plits mLitList[0]〜mLitList[pos - 1] までをまとめたリテラル集合
-  /// @return cover に含まれるカーネルのレベルの最大値を返す．
-  ymuint
-  kern_sub(const AlgCover& cover,
-	   ymuint pos,
-	   const AlgCube& ccube,
-	   const AlgLitSet& plits);
+  ///
+  /// cover を登録したのち，mLitList[pos] 以降のリテラルで割った
+  /// 結果に対する処理を新たなタスクとして投入する．
+  /// 1スレッドの時はタスクにせずに再帰呼び出しする．
+  void
+  kern_sub(
+    Context& ctx,   ///< [in] 実行中の情報
+    AlgCover cover, ///< [in] 対象のカバー(キューブフリー)
+    SizeType pos,   ///< [in] mLitList 上の位置
+    AlgCube ccube   ///< [in] 今までに括りだされた共通のキューブ
+  );
 
 
 private:
@@ -88,11 +147,20 @@ private:
   // データメンバ
   //////////////////////////////////////////////////////////////////////
 
+  // スレッド数
+  SizeType mThreadNum;
+
+  // タスクプール
+  // 2スレッド以上の時に最初の generate() で作られる．
+  unique_ptr<AlgTaskPool> mPool;
+
   // 現在対象としているカバーのリテラルのリスト
   // 出現頻度の昇順になっている．
   vector<AlgLiteral> mLitList;
 
-  // 見つかったカーネルを入れておく作業用のリスト
+  // mLitList[0]〜mLitList[i - 1] をまとめたリテラル集合のリスト
+  vector<AlgLitSet> mPrevLitsList;
+
 };
 
 END_NAMESPACE_YM_BFO
@@ -5,43 +5,33 @@
 /// @brief AlgKernelMgr のヘッダファイル
 /// @author Yusuke Matsunaga (松永 裕介)
 ///
-/// Copyright (C) 2017 Yusuke Matsunaga
+/// Copyright (C) 2017, 2022 Yusuke Matsunaga
 /// All rights reserved.
 
 
 #include "ym/bfo_nsdef.h"
 #include "ym/AlgCover.h"
-#include "ym/HashMap.h"
+#include "ym/AlgLitSet.h"
 
 
-BEGIN_NAMESPACE_YM
-
-/// @breif AlgCover* をキーにしたハッシュ関数クラスの定義
-template <>
-struct HashFunc<const AlgCover*>
-{
-  HashType
-  operator()(const AlgCover* cover) const
-  {
-    return cover->hash();
-  }
-};
-
-END_NAMESPACE_YM
-
 BEGIN_NAMESPACE_YM_BFO
 
 //////////////////////////////////////////////////////////////////////
 /// @class AlgKernelMgr AlgKernelMgr.h "AlgKernelMgr.h"
 /// @brief カーネルとコカーネルの情報を保持するクラス
+///
+/// カーネルは内容をキーにしたハッシュ表で管理するので，
+/// 異なるコカーネルから同じカーネルが得られた場合には1つにまとめられる．<br>
+/// その場合，コカーネルはカバーとしてまとめられる．
 //////////////////////////////////////////////////////////////////////
 class AlgKernelMgr
 {
 public:
 
   /// @brief コンストラクタ
-  /// @param[in] mgr マネージャ
-  AlgKernelMgr(AlgMgr& mgr);
+  AlgKernelMgr(
+    AlgMgr& mgr ///< [in] マネージャ
+  );
 
   /// @brief デストラクタ
   ~AlgKernelMgr();
@@ -53,26 +43,46 @@ public:
   //////////////////////////////////////////////////////////////////////
 
   /// @brief カーネルとコカーネルを求める．
-  /// @param[in] cover 対象のカバー
+  ///
+  /// level0 が true の時はレベル0のカーネル(自分以外のカーネルを
+  /// 含まないカーネル)のみを求める．
   void
-  find_kernels(const AlgCover& cover);
+  find_kernels(
+    const AlgCover& cover, ///< [in] 対象のカバー
+    bool level0 = false    ///< [in] レベル0のカーネルのみを求める時 true にする．
+  );
 
   /// @brief 直前の find_kernels() で求めたカーネルの個数を返す．
-  int
-  kernel_num() const;
+  SizeType
+  kernel_num() const
+  {
+    return mKernelList.size();
+  }
 
   /// @brief 直前の find_kernels() で求めたカーネルを返す．
-  /// @param[in] pos 位置番号 ( 0 <= pos < kernel_num() )
   const AlgCover&
-  kernel(int pos) const;
+  kernel(
+    SizeType pos ///< [in] 位置番号 ( 0 <= pos < kernel_num() )
+  ) const
+  {
+    ASSERT_COND( pos < kernel_num() );
+
+    return mKernelList[pos];
+  }
 
   /// @brief 直前の find_kernels() で求めたコカーネルを返す．
-  /// @param[in] pos 位置番号 ( 0 <= pos < kernel_num() )
   ///
   /// コカーネルはキューブだが一つのカーネルに複数のコカーネル
   /// が対応する場合があるので全体としてカバーで表す．
   const AlgCover&
-  cokernel(int pos) const;
+  cokernel(
+    SizeType pos ///< [in] 位置番号 ( 0 <= pos < kernel_num() )
+  ) const
+  {
+    ASSERT_COND( pos < kernel_num() );
+
+    return mCokernelList[pos];
+  }
 
 
 private:
@@ -85,17 +95,25 @@ private:
   _clear();
 
   /// @brief カーネルを求める再帰関数
-  /// @param[in] cover 対象のカバー
-  /// @param[in] lit_list リテラル(と出現頻度)のリスト
-  /// @param[in] pos 次に処理するリテラルリストの先頭位置
-  /// @param[in] ckcube 現在のコカーネル
-  /// @param[in] skip_cube すでに試したリテラルの集合を表すキューブ
+  ///
+  /// cover 自身を登録したのち，mLitList[pos] 以降のリテラルで
+  /// 割ったものに対して再帰する．<br>
+  /// skip_set に含まれるリテラルを共通キューブに持つ商は
+  /// すでに他の枝で処理されているので飛ばす．
+  void
+  _kernel_sub(
+    const AlgCover& cover,   ///< [in] 対象のカバー(キューブフリー)
+    SizeType pos,            ///< [in] 次に処理するリテラルリストの先頭位置
+    const AlgCube& ckcube,   ///< [in] 現在のコカーネル
+    const AlgLitSet& skip_set ///< [in] すでに試したリテラルの集合
+  );
+
+  /// @brief カーネルを登録する．
   void
-  _kernel_sub(const AlgCover& cover,
-	      vector<pair<AlgLiteral, int> >& lit_list,
-	      int pos,
-	      const AlgCube& ckcube,
-	      const AlgCube& skip_cube);
+  _add_kernel(
+    const AlgCover& kernel, ///< [in] カーネル
+    const AlgCube& ckcube   ///< [in] コカーネル
+  );
 
 
 private:
@@ -106,55 +124,24 @@ private:
   // マネージャ
   AlgMgr& mMgr;
 
+  // レベル0のカーネルのみを求める時 true にするフラグ
+  bool mLevel0{false};
+
+  // 現在対象としているカバーのリテラルのリスト
+  // 2回以上現れるもののみを出現頻度の昇順に並べる．
+  vector<AlgLiteral> mLitList;
+
   // カーネルのリスト
-  vector<AlgCover*> mKernelList;
+  vector<AlgCover> mKernelList;
 
   // コカーネルのリスト
-  vector<AlgCover*> mCokernelList;
+  vector<AlgCover> mCokernelList;
 
-  // カーネルをキーにして番号を保持するハッシュ表
-  HashMap<const AlgCover*, int> mKernelHash;
+  // カーネルの内容をキーにして番号を保持するハッシュ表
+  unordered_map<AlgCover, SizeType> mKernelHash;
 
 };
 
-
-//////////////////////////////////////////////////////////////////////
-// インライン関数の定義
-//////////////////////////////////////////////////////////////////////
-
-// @brief 直前の find_kernels() で求めたカーネルの個数を返す．
-inline
-int
-AlgKernelMgr::kernel_num() const
-{
-  return mKernelList.size();
-}
-
-// @brief 直前の find_kernels() で求めたカーネルを返す．
-// @param[in] pos 位置番号 ( 0 <= pos < kernel_num() )
-inline
-const AlgCover&
-AlgKernelMgr::kernel(int pos) const
-{
-  ASSERT_COND( pos < kernel_num() );
-
-  return *mKernelList[pos];
-}
-
-// @brief 直前の find_kernels() で求めたコカーネルを返す．
-// @param[in] pos 位置番号 ( 0 <= pos < kernel_num() )
-//
-// コカーネルはキューブだが一つのカーネルに複数のコカーネル
-// が対応する場合があるので全体としてカバーで表す．
-inline
-const AlgCover&
-AlgKernelMgr::cokernel(int pos) const
-{
-  ASSERT_COND( pos < kernel_num() );
-
-  return *mCokernelList[pos];
-}
-
 END_NAMESPACE_YM_BFO
 
 #endif // ALGKERNELMGR_H
@@ -63,6 +63,18 @@ public:
     mMgr->cube_copy(mBody, 0, src.mBody, 0);
   }
 
+  /// @brief ムーブコンストラクタ
+  ///
+  /// src の領域を引き継ぐ．
+  /// ムーブ後の src は代入とデストラクタ以外の操作はできない．
+  AlgLitSet(
+    AlgLitSet&& src ///< [in] ムーブ元のオブジェクト
+  ) noexcept : mMgr{src.mMgr},
+	       mBody{src.mBody}
+  {
+    src.mBody = nullptr;
+  }
+
   /// @brief 代入演算子
   /// @return 代入後の自身への参照を返す．
   AlgLitSet&
@@ -71,7 +83,7 @@ public:
   )
   {
     if ( &src != this ) {
-      if ( &mMgr != &src.mMgr ) {
+      if ( mMgr != src.mMgr || mBody == nullptr ) {
 	// マネージャが異なっていたら mBody を作り直す．
 	mMgr->delete_body(mBody);
 	mMgr = src.mMgr;
@@ -86,6 +98,20 @@ public:
     return *this;
   }
 
+  /// @brief ムーブ代入演算子
+  /// @return 代入後の自身への参照を返す．
+  ///
+  /// src には自身の元の内容が入る．
+  AlgLitSet&
+  operator=(
+    AlgLitSet&& src ///< [in] ムーブ元のオブジェクト
+  ) noexcept
+  {
+    swap(src);
+
+    return *this;
+  }
+
   /// @brief デストラクタ
   ~AlgLitSet()
   {
@@ -98,6 +124,16 @@ public:
   // 外部インターフェイス
   //////////////////////////////////////////////////////////////////////
 
+  /// @brief 内容を入れ替える．
+  void
+  swap(
+    AlgLitSet& right ///< [in] 入れ替える相手
+  ) noexcept
+  {
+    std::swap(mMgr, right.mMgr);
+    std::swap(mBody, right.mBody);
+  }
+
   /// @brief マネージャを返す．
   AlgMgr&
   mgr() const
@@ -128,9 +164,24 @@ public:
   AlgLitSet
   operator+(
     AlgLiteral lit ///< [in] 追加するリテラル
-  ) const
+  ) const &
+  {
+    AlgLitSet ans{*this};
+    ans += lit;
+    return ans;
+  }
+
+  /// @brief 要素を足す．
+  /// @return 演算結果を返す．
+  ///
+  /// 自身が右辺値の場合には自身の領域を使って計算する．
+  AlgLitSet
+  operator+(
+    AlgLiteral lit ///< [in] 追加するリテラル
+  ) &&
   {
-    return AlgLitSet(*this).operator+=(lit);
+    operator+=(lit);
+    return std::move(*this);
   }
 
   /// @brief 要素を足す．
@@ -159,6 +210,18 @@ private:
 
 };
 
+/// @relates AlgLitSet
+/// @brief 2つのリテラル集合の内容を入れ替える．
+inline
+void
+swap(
+  AlgLitSet& left, ///< [in] 第1オペランド
+  AlgLitSet& right ///< [in] 第2オペランド
+) noexcept
+{
+  left.swap(right);
+}
+
 END_NAMESPACE_YM_BFO
 
 #endif // ALGLITSET_H
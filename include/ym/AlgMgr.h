@@ -9,16 +9,122 @@
 /// All rights reserved.
 
 #include "ym/bfo_nsdef.h"
+#include <string_view>
+#include <atomic>
 
 
 BEGIN_NAMESPACE_YM_BFO
 
+class AlgBodyAlloc;
+class AlgWorkspace;
+class AlgWorkspaceTable;
+class AlgOpCache;
+struct AlgCubeOps;
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgAllocStats AlgMgr.h "ym/AlgMgr.h"
+/// @brief AlgMgr のメモリ確保に関する統計情報
+//////////////////////////////////////////////////////////////////////
+struct AlgAllocStats
+{
+  /// @brief new_body() の呼ばれた回数
+  SizeType alloc_num{0};
+
+  /// @brief delete_body() の呼ばれた回数
+  SizeType free_num{0};
+
+  /// @brief フリーリストの領域を再利用した回数
+  SizeType reuse_num{0};
+
+  /// @brief システムから確保したチャンク数
+  SizeType chunk_num{0};
+
+  /// @brief システムから確保した総ワード数
+  SizeType reserved_words{0};
+
+  /// @brief 現在使用中のワード数
+  SizeType used_words{0};
+
+  /// @brief 使用中のワード数の最大値
+  SizeType peak_words{0};
+
+};
+
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgWorkspaceStats AlgMgr.h "ym/AlgMgr.h"
+/// @brief AlgMgr の作業領域に関する統計情報
+//////////////////////////////////////////////////////////////////////
+struct AlgWorkspaceStats
+{
+  /// @brief フレーム数の最大値
+  SizeType max_depth{0};
+
+  /// @brief 同時に使用されたワード数の最大値(high-water mark)
+  SizeType peak_words{0};
+
+  /// @brief 確保されているワード数
+  SizeType reserved_words{0};
+
+  /// @brief 領域を確保した回数
+  SizeType alloc_num{0};
+
+};
+
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgOpCacheStats AlgMgr.h "ym/AlgMgr.h"
+/// @brief AlgMgr の演算結果のキャッシュに関する統計情報
+//////////////////////////////////////////////////////////////////////
+struct AlgOpCacheStats
+{
+  /// @brief キャッシュに結果があった回数
+  SizeType hit_num{0};
+
+  /// @brief キャッシュに結果がなかった回数
+  SizeType miss_num{0};
+
+  /// @brief 追い出したエントリ数
+  SizeType evict_num{0};
+
+  /// @brief 現在のエントリ数
+  SizeType entry_num{0};
+
+  /// @brief 現在使用中のワード数
+  SizeType used_words{0};
+
+  /// @brief 使用できるワード数の上限
+  SizeType limit_words{0};
+
+};
+
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgSignatureStats AlgMgr.h "ym/AlgMgr.h"
+/// @brief AlgMgr のキューブシグネチャによる事前判定に関する統計情報
+//////////////////////////////////////////////////////////////////////
+struct AlgSignatureStats
+{
+  /// @brief シグネチャで判定した回数
+  SizeType check_num{0};
+
+  /// @brief シグネチャだけで除外できた回数
+  SizeType reject_num{0};
+
+};
+
+
 //////////////////////////////////////////////////////////////////////
 /// @class AlgMgr AlgMgr.h "ym/AlgMgr.h"
 /// @brief AlgCube, AlgCover を管理するクラス
 ///
 /// といっても実際の役割は入力数を覚えておくことと
-/// 変数名のリストを持っておくことだけ．
+/// 変数名のリストを持っておくことだけ．<br>
+/// 変数の数と変数名はコンストラクタで決まり，以降は変更されない．
+/// 演算用の作業領域はスレッドごとに用意され，new_body()/delete_body()
+/// は内部で排他制御を行うので，同じマネージャに属するカバーの演算を
+/// 複数のスレッドから同時に行ってもよい．<br>
+/// ただし，同じオブジェクトを同時に書き換えてはいけない．
 //////////////////////////////////////////////////////////////////////
 class AlgMgr
 {
@@ -54,6 +160,33 @@ public:
     return mVarNum;
   }
 
+  /// @brief キューブ1つ分のワード数を返す．
+  SizeType
+  cube_size() const
+  {
+    return _cube_size();
+  }
+
+  /// @brief 和と積で自動的に SCC 極小化を行う時 true を返す．
+  bool
+  auto_scc() const
+  {
+    return mAutoScc;
+  }
+
+  /// @brief 和と積で自動的に SCC 極小化を行うかを設定する．
+  ///
+  /// true にすると AlgCover の和と積の演算子の結果に
+  /// scc_minimal() を適用する．デフォルトは false．<br>
+  /// 演算の途中で変更してはいけない．
+  void
+  set_auto_scc(
+    bool flag ///< [in] 設定する値
+  )
+  {
+    mAutoScc = flag;
+  }
+
   /// @brief 変数名を返す．
   string
   varname(
@@ -64,6 +197,13 @@ public:
     return mVarNameList[var_id];
   }
 
+  /// @brief 変数名から変数番号を求める．
+  /// @return 見つからなければ variable_num() を返す．
+  SizeType
+  varid(
+    std::string_view name ///< [in] 変数名
+  ) const;
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -84,6 +224,23 @@ public:
     return static_cast<AlgPol>((bv[blk] >> sft) & 3ULL);
   }
 
+  /// @brief ビットベクタにリテラルの極性をセットする．
+  ///
+  /// もとの値との OR をとる．
+  void
+  set_literal(
+    ymuint64* bv,     ///< [in] ビットベクタ
+    SizeType cube_id, ///< [in] キューブ番号
+    SizeType var_id,  ///< [in] 変数番号 ( 0 <= var_id < variable_num() )
+    AlgPol pol        ///< [in] 極性
+  )
+  {
+    ASSERT_COND( var_id < variable_num() );
+    SizeType blk = _block_pos(var_id) + _cube_size() * cube_id;
+    SizeType sft = _shift_num(var_id);
+    bv[blk] |= (static_cast<ymuint64>(pol) << sft);
+  }
+
   /// @brief ビットベクタ上のリテラル数を数える．
   SizeType
   literal_num(
@@ -99,9 +256,36 @@ public:
     AlgLiteral lit      ///< [in] 対象のリテラル
   );
 
+  /// @brief ビットベクタ上の全リテラルの出現頻度を数える．
+  ///
+  /// counts は variable_num() * 2 の大きさになり，
+  /// counts[lit.index()] に lit の出現回数が入る．<br>
+  /// リテラルごとに literal_num() を呼ぶのと異なり，
+  /// ビットベクタを1回なめるだけで済む．
+  void
+  literal_histogram(
+    SizeType nc,             ///< [in] キューブ数
+    const ymuint64* bv,      ///< [in] カバーを表すビットベクタ
+    vector<SizeType>& counts ///< [out] 出現頻度を格納する配列
+  );
+
+  /// @brief 指定回数以上現れるリテラルを出現頻度の昇順に並べる．
+  ///
+  /// 出現回数が等しいリテラルは AlgLiteral::index() の昇順とする．
+  void
+  literal_list_by_frequency(
+    SizeType nc,                 ///< [in] キューブ数
+    const ymuint64* bv,          ///< [in] カバーを表すビットベクタ
+    SizeType min_num,            ///< [in] 出現回数の下限
+    vector<AlgLiteral>& lit_list ///< [out] リテラルのリスト
+  );
+
   /// @brief キューブ/カバー用の領域を確保する．
   ///
-  /// キューブの時は cube_num = 1 とする．
+  /// キューブの時は cube_num = 1 とする．<br>
+  /// 領域はキューブ数を2のべき乗に切り上げたサイズクラスごとに
+  /// 管理されており，delete_body() で返された領域は再利用される．<br>
+  /// 内容は 0 に初期化されている．
   ymuint64*
   new_body(
     SizeType cube_num = 1 ///< [in] キューブ数
@@ -109,13 +293,64 @@ public:
 
   /// @brief キューブ/カバー用の領域を削除する．
   ///
-  /// キューブの時は cube_num = 1 とする．
+  /// キューブの時は cube_num = 1 とする．<br>
+  /// cube_num は new_body() の時と同じ値でなければならない．<br>
+  /// 実際にはフリーリストに戻されるだけで，システムへの解放は
+  /// AlgMgr のデストラクタでまとめて行われる．
   void
   delete_body(
     ymuint64* p,          ///< [in] 領域を指すポインタ
     SizeType cube_num = 1 ///< [in] キューブ数
   );
 
+  /// @brief new_body()/delete_body() の統計情報を返す．
+  AlgAllocStats
+  alloc_stats() const;
+
+  /// @brief 呼び出したスレッドの作業領域の統計情報を返す．
+  const AlgWorkspaceStats&
+  workspace_stats() const;
+
+  /// @brief 作業領域を持っているスレッド数を返す．
+  ///
+  /// 作業領域はスレッドの終了時に解放される．
+  SizeType
+  workspace_num() const;
+
+  /// @brief 演算結果のキャッシュを有効にする．
+  ///
+  /// 有効にするとカバー同士の product() と division() の結果を
+  /// 被演算子の内容をキーにして記憶し，同じ演算の2度目以降は
+  /// 記憶した結果を返す．<br>
+  /// 記憶する被演算子と結果の総ワード数は limit_words 以下に保たれ，
+  /// あふれた場合は clock 法で最近使われていないエントリを追い出す．<br>
+  /// すでに有効な場合は記憶していた結果を破棄する．<br>
+  /// キャッシュ自体は内部で排他制御を行うが，この関数と
+  /// disable_op_cache() を他のスレッドの演算と同時に呼んではいけない．
+  void
+  enable_op_cache(
+    SizeType limit_words = 1024 * 1024 ///< [in] 使用できるワード数の上限
+  );
+
+  /// @brief 演算結果のキャッシュを無効にする．
+  ///
+  /// 記憶していた結果は破棄される．
+  void
+  disable_op_cache();
+
+  /// @brief 演算結果のキャッシュが有効な時 true を返す．
+  bool
+  op_cache_enabled() const
+  {
+    return mOpCache != nullptr;
+  }
+
+  /// @brief 演算結果のキャッシュの統計情報を返す．
+  ///
+  /// キャッシュが無効な場合はすべて 0 となる．
+  AlgOpCacheStats
+  op_cache_stats() const;
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -130,13 +365,36 @@ public:
   /// @brief カバー/キューブを表す文字列をパーズする．
   /// @return キューブ数を返す．
   ///
-  /// lit_list 中の AlgLiteralUndef はキューブの区切りとみなす．
+  /// lit_list 中の AlgLiteralUndef はキューブの区切りとみなす．<br>
+  /// エラーの場合は 0 を返し，lit_list は空となる．
   SizeType
   parse(
     const char* str,             ///< [in] 対象の文字列
     vector<AlgLiteral>& lit_list ///< [out] パーズ結果のリテラルのリスト
   );
 
+  /// @brief カバー/キューブを表す文字列をパーズしてビットベクタに書き込む．
+  /// @return キューブ数を返す．
+  ///
+  /// 中間のリテラルのリストを作らずに1パスで処理する．<br>
+  /// dst_bv には parse_cube_num(str) 個のキューブ分の領域が必要となる．<br>
+  /// エラーの場合は 0 を返し，err_pos にエラーの見つかったバイト位置を
+  /// セットする．この時 dst_bv の内容は不定となる．
+  /// エラーがなかった場合，err_pos は str.size() となる．
+  SizeType
+  parse(
+    std::string_view str, ///< [in] 対象の文字列
+    ymuint64* dst_bv,     ///< [in] 結果を格納するビットベクタ
+    SizeType& err_pos     ///< [out] エラー位置
+  );
+
+  /// @brief parse() の結果のキューブ数の上限を返す．
+  static
+  SizeType
+  parse_cube_num(
+    std::string_view str ///< [in] 対象の文字列
+  );
+
   /// @brief リテラルをセットする．
   ///
   /// lit_list 中の AlgLiteralUndef はキューブの区切りとみなす．
@@ -174,6 +432,11 @@ public:
 
   /// @brief 2つのカバーの論理積を計算する．
   /// @return 結果のキューブ数を返す．
+  ///
+  /// 結果は整列済みで重複したキューブは取り除かれる．<br>
+  /// dst_bv は bv1 と bv2 のどちら(あるいは両方)と同じでもよい．<br>
+  /// 各キューブの全ワードの OR をシグネチャとして
+  /// 相反するリテラルを含まないペアを先に選り分ける．
   SizeType
   product(
     ymuint64* dst_bv,    ///< [in] 結果を格納するビットベクタ
@@ -185,6 +448,8 @@ public:
 
   /// @brief カバーとリテラルとの論理積を計算する．
   /// @return 結果のキューブ数を返す．
+  ///
+  /// 結果は整列済みで重複したキューブは取り除かれる．
   SizeType
   product(
     ymuint64* dst_bv,    ///< [in] 結果を格納するビットベクタ
@@ -195,13 +460,41 @@ public:
 
   /// @brief カバーの代数的除算を行う．
   /// @return 結果のキューブ数を返す．
+  ///
+  /// sig1, sig2 は cube_signature() で求めた各カバーのシグネチャ．
+  /// nullptr の場合は内部で求める．
   SizeType
   division(
-    ymuint64* dst_bv,    ///< [in] 結果を格納するビットベクタ
-    SizeType nc1,	 ///< [in] 1つめのカバーのキューブ数
-    const ymuint64* bv1, ///< [in] 1つめのカバーを表すビットベクタ
-    SizeType nc2,	 ///< [in] 2つめのカバーのキューブ数
-    const ymuint64* bv2	 ///< [in] 2つめのカバーを表すビットベクタ
+    ymuint64* dst_bv,              ///< [in] 結果を格納するビットベクタ
+    SizeType nc1,		   ///< [in] 1つめのカバーのキューブ数
+    const ymuint64* bv1,           ///< [in] 1つめのカバーを表すビットベクタ
+    SizeType nc2,		   ///< [in] 2つめのカバーのキューブ数
+    const ymuint64* bv2,	   ///< [in] 2つめのカバーを表すビットベクタ
+    const ymuint64* sig1 = nullptr, ///< [in] 1つめのカバーのシグネチャ
+    const ymuint64* sig2 = nullptr  ///< [in] 2つめのカバーのシグネチャ
+  );
+
+  /// @brief カバーの代数的除算を行い，剰余も求める．
+  /// @return 商のキューブ数を返す．
+  ///
+  /// 剰余は被除数のキューブのうち，商と除数の積に含まれない
+  /// ものとなる．<br>
+  /// dst_bv と rem_bv は異なる領域でなければならないが，
+  /// どちらかが bv1 と同じであってもよい．<br>
+  /// rem_bv が nullptr の場合には剰余は求めない．<br>
+  /// sig1, sig2 は cube_signature() で求めた各カバーのシグネチャ．
+  /// nullptr の場合は内部で求める．
+  SizeType
+  division(
+    ymuint64* dst_bv,              ///< [in] 商を格納するビットベクタ
+    ymuint64* rem_bv,              ///< [in] 剰余を格納するビットベクタ
+    SizeType& rem_nc,              ///< [out] 剰余のキューブ数
+    SizeType nc1,		   ///< [in] 1つめのカバーのキューブ数
+    const ymuint64* bv1,           ///< [in] 1つめのカバーを表すビットベクタ
+    SizeType nc2,		   ///< [in] 2つめのカバーのキューブ数
+    const ymuint64* bv2,	   ///< [in] 2つめのカバーを表すビットベクタ
+    const ymuint64* sig1 = nullptr, ///< [in] 1つめのカバーのシグネチャ
+    const ymuint64* sig2 = nullptr  ///< [in] 2つめのカバーのシグネチャ
   );
 
   /// @brief カバーをリテラルで割る．
@@ -224,6 +517,40 @@ public:
     const ymuint64* bv1 ///< [in] カバーを表すビットベクタ
   );
 
+  /// @brief ビットプレーン1枚分のワード数を返す．
+  static
+  SizeType
+  plane_size(
+    SizeType nc ///< [in] キューブ数
+  )
+  {
+    return (nc + 63) / 64;
+  }
+
+  /// @brief カバーをビットプレーン形式に変換する．
+  ///
+  /// ビットプレーンはリテラルごとに plane_size(nc) ワードの領域で，
+  /// i 番目のキューブがそのリテラルを含む時 i ビット目が 1 となる．<br>
+  /// planes はリテラル番号(AlgLiteral::index())の順に並べた
+  /// variable_num() * 2 * plane_size(nc) ワードの領域でなければならない．
+  void
+  to_bitplane(
+    ymuint64* planes,   ///< [in] 結果を格納する領域
+    SizeType nc,        ///< [in] キューブ数
+    const ymuint64* bv  ///< [in] カバーを表すビットベクタ
+  );
+
+  /// @brief ビットプレーン形式からカバーのビットベクタを作る．
+  ///
+  /// to_bitplane() の逆変換を行う．<br>
+  /// dst_bv には nc 個のキューブ分の領域が必要となる．
+  void
+  from_bitplane(
+    ymuint64* dst_bv,        ///< [in] 結果を格納するビットベクタ
+    SizeType nc,             ///< [in] キューブ数
+    const ymuint64* planes   ///< [in] ビットプレーン
+  );
+
   /// @brief カバー(を表すビットベクタ)のコピーを行う．
   void
   copy(
@@ -235,14 +562,65 @@ public:
   );
 
   /// @brief カバー(を表すビットベクタ)を整列する．
-  void
+  /// @return 重複を取り除いたあとのキューブ数を返す．
+  ///
+  /// 順序は cube_compare() の降順となる．<br>
+  /// 重複したキューブは1つにまとめられる．<br>
+  /// キューブ数が少ない時にはその場でマージソートを行う．
+  /// キューブ数が多い時にはキューブ番号の配列を整列してから
+  /// 一度だけキューブを移動する．
+  /// さらに1キューブのワード数が少ない場合には MSD radix sort を用いる．
+  SizeType
   sort(
     SizeType cube_num, ///< [in] キューブ数
     ymuint64* bv       ///< [in] ビットベクタ
-  )
+  );
+
+  /// @brief 他のキューブに含まれるキューブを取り除く．
+  /// @return 結果のキューブ数を返す．
+  ///
+  /// 単一キューブ包含(single cube containment)に関して極小にする．<br>
+  /// 残ったキューブの順序は変わらない．<br>
+  /// sig が nullptr でない場合は cube_signature() で求めたシグネチャ
+  /// として用い，キューブと同じように詰める．<br>
+  /// キューブ数は 2^32 未満でなければならない．
+  SizeType
+  scc_minimal(
+    SizeType cube_num,      ///< [in] キューブ数
+    ymuint64* bv,           ///< [in] ビットベクタ
+    ymuint64* sig = nullptr ///< [in] シグネチャ
+  );
+
+  /// @brief キューブごとのシグネチャを求める．
+  ///
+  /// シグネチャはキューブの全ワードの OR で，各変数のリテラルを
+  /// 変数番号を 32 で割った余りの位置に畳み込んだものとなる．<br>
+  /// キューブ c のリテラルがキューブ d のリテラルを全て含んでいれば
+  /// sig(d) は sig(c) に含まれるので，含まれない組は
+  /// キューブ本体を見ずに除外できる．
+  void
+  cube_signature(
+    ymuint64* sig,     ///< [in] 結果を格納する配列(nc 要素)
+    SizeType nc,       ///< [in] キューブ数
+    const ymuint64* bv ///< [in] ビットベクタ
+  );
+
+  /// @brief シグネチャによる事前判定の統計情報を返す．
+  ///
+  /// division() と scc_minimal() の中での判定が数えられる．
+  AlgSignatureStats
+  signature_stats() const
   {
-    // 下請け関数を呼ぶだけ
-    _sort(bv, 0, cube_num);
+    return AlgSignatureStats{mSigCheckNum.load(std::memory_order_relaxed),
+			     mSigRejectNum.load(std::memory_order_relaxed)};
+  }
+
+  /// @brief シグネチャによる事前判定の統計情報をクリアする．
+  void
+  clear_signature_stats()
+  {
+    mSigCheckNum = 0;
+    mSigRejectNum = 0;
   }
 
   /// @brief カバー(を表すビットベクタ)の比較を行う．
@@ -260,12 +638,31 @@ public:
   );
 
   /// @brief ビットベクタからハッシュ値を計算する．
+  ///
+  /// hash_append(kHashInit, nc, bv) と同じ値になる．
   SizeType
   hash(
     SizeType nc,       ///< [in] キューブ数
     const ymuint64* bv ///< [in] ビットベクタ
   );
 
+  /// @brief ハッシュ値にキューブを追加する．
+  /// @return 追加後のハッシュ値を返す．
+  ///
+  /// キューブを順に追加していったものは，まとめて hash() を
+  /// 計算したものと同じ値になる．<br>
+  /// 最初は h = kHashInit から始める．
+  SizeType
+  hash_append(
+    SizeType h,        ///< [in] それまでのハッシュ値
+    SizeType nc,       ///< [in] 追加するキューブ数
+    const ymuint64* bv ///< [in] 追加するキューブのビットベクタ
+  );
+
+  /// @brief hash_append() の初期値
+  static
+  constexpr SizeType kHashInit = 0x243F6A8885A308D3ULL;
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -365,13 +762,7 @@ public:
     SizeType pos1, ///< [in] 1つめのキューブ番号
     ymuint64* bv2, ///< [in] 2つめのカバーを表すビットベクタ
     SizeType pos2  ///< [in] 2つめのキューブ番号
-  )
-  {
-    // mTmpBuff を介して移動する．
-    _cube_save(bv1, pos1);
-    cube_copy(bv1, pos1, bv2, pos2);
-    _cube_restore(bv2, pos2);
-  }
+  );
 
   /// @brief 3つのキューブ(を表すビットベクタ)を入れ替える．
   ///
@@ -384,14 +775,7 @@ public:
     SizeType pos2, ///< [in] 2つめのキューブ番号
     ymuint64* bv3, ///< [in] 3つめのカバーを表すビットベクタ
     SizeType pos3  ///< [in] 3つめのキューブ番号
-  )
-  {
-    // mTmpBuff を介して移動する．
-    _cube_save(bv1, pos1);
-    cube_copy(bv1, pos1, bv2, pos2);
-    cube_copy(bv2, pos2, bv3, pos3);
-    _cube_restore(bv3, pos3);
-  }
+  );
 
   /// @brief 4つのキューブ(を表すビットベクタ)を入れ替える．
   ///
@@ -406,15 +790,7 @@ public:
     SizeType pos3, ///< [in] 3つめのキューブ番号
     ymuint64* bv4, ///< [in] 4つめのカバーを表すビットベクタ
     SizeType pos4  ///< [in] 4つめのキューブ番号
-  )
-  {
-    // mTmpBuff を介して移動する．
-    _cube_save(bv1, pos1);
-    cube_copy(bv1, pos1, bv2, pos2);
-    cube_copy(bv2, pos2, bv3, pos3);
-    cube_copy(bv3, pos3, bv4, pos4);
-    _cube_restore(bv4, pos4);
-  }
+  );
 
   /// @brief カバー/キューブの内容を出力する．
   ///
@@ -457,7 +833,8 @@ private:
 
   /// @brief マージソートを行う下請け関数
   ///
-  /// bv[start] - bv[end - 1] の領域をソートする．
+  /// bv[start] - bv[end - 1] の領域をソートする．<br>
+  /// 重複したキューブは隣り合って残る．
   void
   _sort(
     ymuint64* bv,   ///< [in] 対象のビットベクタ
@@ -465,35 +842,104 @@ private:
     SizeType end    ///< [in] 終了位置
   );
 
-  /// @brief mTmpBuff を初期化する．
+  /// @brief キューブ番号の配列を比較関数で整列する．
   void
-  _init_buff();
+  _index_sort(
+    const ymuint64* bv, ///< [in] 対象のビットベクタ
+    ymuint64* idx,      ///< [in] キューブ番号の配列
+    SizeType n          ///< [in] 要素数
+  );
 
-  /// @brief mTmpBuff に必要な領域を確保する．
+  /// @brief キューブ番号の配列を MSD radix sort で整列する．
+  ///
+  /// idx[0] - idx[n - 1] のキューブは先頭から byte_pos - 1 バイト目
+  /// までは等しいと仮定している．
   void
-  _resize_buff(
-    SizeType req_size ///< [in] 要求するキューブ数
+  _radix_sort(
+    const ymuint64* bv, ///< [in] 対象のビットベクタ
+    ymuint64* idx,      ///< [in] キューブ番号の配列
+    ymuint64* tmp,      ///< [in] 作業用の配列
+    SizeType n,         ///< [in] 要素数
+    SizeType byte_pos   ///< [in] 対象のバイト位置
   );
 
-  /// @brief キューブ(を表すビットベクタ)をバッファにコピーする．
-  void
-  _cube_save(
-    const ymuint64* src_bv, ///< [in] ソースのビットベクタ
-    SizeType src_pos        ///< [in] ソースのキューブ番号
-  )
-  {
-    cube_copy(mTmpBuff, 0, src_bv, src_pos);
-  }
+  /// @brief product() の本体
+  /// @return 結果のキューブ数を返す．
+  SizeType
+  _product(
+    ymuint64* dst_bv,    ///< [in] 結果を格納するビットベクタ
+    SizeType nc1,	 ///< [in] 1つめのカバーのキューブ数
+    const ymuint64* bv1, ///< [in] 1つめのカバーを表すビットベクタ
+    SizeType nc2,	 ///< [in] 2つめのカバーのキューブ数
+    const ymuint64* bv2	 ///< [in] 2つめのカバーを表すビットベクタ
+  );
 
-  /// @brief キューブ(を表すビットベクタ)をバッファからコピーする．
-  void
-  _cube_restore(
-    ymuint64* dst_bv, ///< [in] コピー先のビットベクタ
-    SizeType dst_pos  ///< [in] コピー先のキューブ番号
-  )
-  {
-    cube_copy(dst_bv, dst_pos, mTmpBuff, 0);
-  }
+  /// @brief division() の本体
+  /// @return 商のキューブ数を返す．
+  SizeType
+  _division(
+    ymuint64* dst_bv,     ///< [in] 商を格納するビットベクタ
+    ymuint64* rem_bv,     ///< [in] 剰余を格納するビットベクタ
+    SizeType& rem_nc,     ///< [out] 剰余のキューブ数
+    SizeType nc1,	  ///< [in] 1つめのカバーのキューブ数
+    const ymuint64* bv1,  ///< [in] 1つめのカバーを表すビットベクタ
+    SizeType nc2,	  ///< [in] 2つめのカバーのキューブ数
+    const ymuint64* bv2,  ///< [in] 2つめのカバーを表すビットベクタ
+    const ymuint64* sig1, ///< [in] 1つめのカバーのシグネチャ
+    const ymuint64* sig2  ///< [in] 2つめのカバーのシグネチャ
+  );
+
+  /// @brief 演算結果のキャッシュ用のハッシュ値を求める．
+  SizeType
+  _op_hash(
+    int op,              ///< [in] 演算の種類
+    SizeType nc1,	 ///< [in] 1つめのカバーのキューブ数
+    const ymuint64* bv1, ///< [in] 1つめのカバーを表すビットベクタ
+    SizeType nc2,	 ///< [in] 2つめのカバーのキューブ数
+    const ymuint64* bv2	 ///< [in] 2つめのカバーを表すビットベクタ
+  );
+
+  /// @brief 整列したビットベクタから隣り合った重複を取り除く．
+  /// @return 重複を取り除いたあとのキューブ数を返す．
+  SizeType
+  _unique(
+    SizeType cube_num, ///< [in] キューブ数
+    ymuint64* bv       ///< [in] ビットベクタ
+  );
+
+  /// @brief キューブのハッシュ値を求める．
+  ///
+  /// division() の中で用いる．
+  SizeType
+  _cube_hash(
+    const ymuint64* bv, ///< [in] カバーを表すビットベクタ
+    SizeType pos        ///< [in] キューブ番号
+  );
+
+  /// @brief 呼び出したスレッド用の作業領域を返す．
+  AlgWorkspace&
+  _workspace() const;
+
+  /// @brief parse() の本体
+  /// @return キューブ数を返す．
+  ///
+  /// lit_list と dst_bv のうち nullptr でないものに結果を書き込む．<br>
+  /// エラーの場合は 0 を返し，err_pos にエラー位置をセットする．
+  SizeType
+  _parse(
+    std::string_view str,         ///< [in] 対象の文字列
+    vector<AlgLiteral>* lit_list, ///< [out] リテラルのリスト
+    ymuint64* dst_bv,             ///< [in] 結果を格納するビットベクタ
+    SizeType& err_pos             ///< [out] エラー位置
+  );
+
+  /// @brief 変数名のハッシュ表を探す．
+  /// @return 見つからなければ variable_num() を返す．
+  SizeType
+  _find_var(
+    std::string_view name, ///< [in] 変数名
+    SizeType hash          ///< [in] name のハッシュ値
+  ) const;
 
   /// @brief ブロック位置を計算する．
   static
@@ -529,20 +975,42 @@ private:
   // データメンバ
   //////////////////////////////////////////////////////////////////////
 
+  // 以下の3つはコンストラクタで設定されたあとは変更されない．
+
   // 変数の数
-  SizeType mVarNum;
+  const SizeType mVarNum;
 
   // 変数名のリスト
-  vector<string> mVarNameList;
+  const vector<string> mVarNameList;
+
+  // 変数名から変数番号を引くハッシュ表(mVarNameList の逆写像)
+  // 線形探査のオープンアドレス法で，空きスロットは mVarNum とする．
+  // サイズは2のべき乗
+  const vector<SizeType> mVarHashTable;
+
+  // キューブ単位の演算を行う関数の表
+  // キューブのワード数に合わせて特殊化されたものを用いる．
+  const AlgCubeOps* mCubeOps;
+
+  // new_body()/delete_body() 用のアロケータ
+  // 内部で排他制御を行う．
+  unique_ptr<AlgBodyAlloc> mAlloc;
+
+  // スレッドごとの作業領域
+  unique_ptr<AlgWorkspaceTable> mWorkspaceTable;
+
+  // 和と積で自動的に SCC 極小化を行う時 true にするフラグ
+  bool mAutoScc{false};
 
-  // 変数名と変数番号のハッシュ表(mVarNameList の逆写像)
-  unordered_map<string, SizeType> mVarNameMap;
+  // 演算結果のキャッシュ
+  // 無効な時は nullptr となる．
+  unique_ptr<AlgOpCache> mOpCache;
 
-  // 作業用に用いられるビットベクタ
-  ymuint64* mTmpBuff;
+  // シグネチャで判定した回数
+  std::atomic<SizeType> mSigCheckNum{0};
 
-  // mTmpBuff のキューブ数
-  SizeType mTmpBuffSize;
+  // シグネチャだけで除外できた回数
+  std::atomic<SizeType> mSigRejectNum{0};
 
 };
 
@@ -0,0 +1,224 @@
+#ifndef ALGPLAREADER_H
+#define ALGPLAREADER_H
+
+/// @file AlgPlaReader.h
+/// @brief AlgPlaReader のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/bfo_nsdef.h"
+#include "ym/AlgCover.h"
+#include "ym/AlgMgr.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgPlaReader AlgPlaReader.h "ym/AlgPlaReader.h"
+/// @brief Berkeley PLA (espresso) 形式のファイルを読み込むクラス
+///
+/// 1行ずつ読みながらキューブのビットパタンを直接カバーの本体に書き込む．
+/// .p 行があればその値で本体の領域をあらかじめ確保する．<br>
+/// 出力ごとに1つのカバーを作る．すべてのカバーは入力数を変数の数
+/// とする1つの AlgMgr を共有する．.ilb 行があればそれを変数名とする．<br>
+/// 出力部の '1' (と '4') のみを ON-set として扱い，'0', '-', '~' は
+/// 無視する．そのため .type は f と fd のみを受け付ける．<br>
+/// 作られたカバーは mgr() を参照しているので，このオブジェクトより
+/// 長く使ってはいけない．
+//////////////////////////////////////////////////////////////////////
+class AlgPlaReader
+{
+public:
+
+  /// @brief コンストラクタ
+  AlgPlaReader();
+
+  /// @brief デストラクタ
+  ~AlgPlaReader();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ファイルを読み込む．
+  /// @return 読み込みが成功したら true を返す．
+  ///
+  /// 前の読み込み結果は破棄される．
+  bool
+  read(
+    const string& filename ///< [in] ファイル名
+  );
+
+  /// @brief ストリームから読み込む．
+  /// @return 読み込みが成功したら true を返す．
+  ///
+  /// 前の読み込み結果は破棄される．
+  bool
+  read(
+    istream& s ///< [in] 入力ストリーム
+  );
+
+  /// @brief 入力数を返す．
+  SizeType
+  input_num() const
+  {
+    return mInputNum;
+  }
+
+  /// @brief 出力数を返す．
+  SizeType
+  output_num() const
+  {
+    return mOutputNum;
+  }
+
+  /// @brief 出力名のリストを返す．
+  ///
+  /// .ob 行がなかった場合は空となる．
+  const vector<string>&
+  output_name_list() const
+  {
+    return mOutputNameList;
+  }
+
+  /// @brief マネージャを返す．
+  ///
+  /// read() が成功した後でのみ意味を持つ．
+  AlgMgr&
+  mgr() const
+  {
+    ASSERT_COND( mMgr != nullptr );
+
+    return *mMgr;
+  }
+
+  /// @brief カバーのリストを返す．
+  ///
+  /// 各出力の ON-set を表す．
+  vector<AlgCover>&
+  cover_list()
+  {
+    return mCoverList;
+  }
+
+  /// @brief エラーメッセージを返す．
+  ///
+  /// read() が失敗した時のみ意味を持つ．
+  const string&
+  error_message() const
+  {
+    return mErrorMessage;
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  // 読み込み中のカバーの本体
+  struct Body
+  {
+    // 本体
+    ymuint64* mBody;
+
+    // キューブ数
+    SizeType mCubeNum;
+
+    // キューブ容量
+    SizeType mCubeCap;
+  };
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 読み込み結果をクリアする．
+  void
+  _clear();
+
+  /// @brief ドットで始まる行を処理する．
+  /// @return エラーがあったら false を返す．
+  bool
+  _read_command(
+    const vector<string>& token_list ///< [in] 空白で区切られたトークンのリスト
+  );
+
+  /// @brief キューブを表す行を処理する．
+  /// @return エラーがあったら false を返す．
+  bool
+  _read_cube(
+    const char* str ///< [in] 対象の文字列
+  );
+
+  /// @brief マネージャと本体の領域を用意する．
+  /// @return エラーがあったら false を返す．
+  bool
+  _init();
+
+  /// @brief 本体に1キューブ分の領域を確保する．
+  /// @return 確保したキューブ位置を返す．
+  SizeType
+  _new_cube(
+    Body& body ///< [in] 対象の本体
+  );
+
+  /// @brief エラーメッセージをセットする．
+  /// @return 常に false を返す．
+  bool
+  _error(
+    const string& msg ///< [in] メッセージ
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 入力数
+  SizeType mInputNum{0};
+
+  // 出力数
+  SizeType mOutputNum{0};
+
+  // .p で指定されたキューブ数
+  SizeType mCubeNumHint{0};
+
+  // 入力名のリスト
+  vector<string> mInputNameList;
+
+  // 出力名のリスト
+  vector<string> mOutputNameList;
+
+  // マネージャ
+  // mCoverList より先に宣言して後に破棄されるようにする．
+  unique_ptr<AlgMgr> mMgr;
+
+  // 読み込み中の本体のリスト
+  vector<Body> mBodyList;
+
+  // カバーのリスト
+  vector<AlgCover> mCoverList;
+
+  // 現在の行番号
+  SizeType mLineNo{0};
+
+  // キューブの入力部のパタン
+  vector<ymuint64> mInputPat;
+
+  // エラーメッセージ
+  string mErrorMessage;
+
+};
+
+END_NAMESPACE_YM_BFO
+
+#endif // ALGPLAREADER_H
@@ -0,0 +1,78 @@
+#ifndef ALGPLAWRITER_H
+#define ALGPLAWRITER_H
+
+/// @file AlgPlaWriter.h
+/// @brief AlgPlaWriter のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/bfo_nsdef.h"
+#include "ym/AlgCover.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+/// @class AlgPlaWriter AlgPlaWriter.h "ym/AlgPlaWriter.h"
+/// @brief カバーのリストを Berkeley PLA (espresso) 形式で書き出すクラス
+///
+/// AlgPlaReader と対になっている．<br>
+/// 各カバーを1つの出力とし，変数名を .ilb として書き出す．<br>
+/// キューブはカバーごとに1行ずつ書き出すので，複数の出力に共通な
+/// キューブは出力の数だけ現れる．
+//////////////////////////////////////////////////////////////////////
+class AlgPlaWriter
+{
+public:
+
+  /// @brief コンストラクタ
+  ///
+  /// output_name_list が空でなければ .ob として書き出す．
+  AlgPlaWriter(
+    const vector<string>& output_name_list = {} ///< [in] 出力名のリスト
+  );
+
+  /// @brief デストラクタ
+  ~AlgPlaWriter();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ファイルに書き出す．
+  /// @return 書き出しが成功したら true を返す．
+  bool
+  write(
+    const string& filename,            ///< [in] ファイル名
+    const vector<AlgCover>& cover_list ///< [in] カバーのリスト
+  );
+
+  /// @brief ストリームに書き出す．
+  ///
+  /// cover_list は空であってはならず，すべてのカバーは
+  /// 同じ AlgMgr に属していなければならない．
+  void
+  write(
+    ostream& s,                        ///< [in] 出力ストリーム
+    const vector<AlgCover>& cover_list ///< [in] カバーのリスト
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 出力名のリスト
+  vector<string> mOutputNameList;
+
+};
+
+END_NAMESPACE_YM_BFO
+
+#endif // ALGPLAWRITER_H
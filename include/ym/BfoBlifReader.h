@@ -0,0 +1,204 @@
+#ifndef BFOBLIFREADER_H
+#define BFOBLIFREADER_H
+
+/// @file BfoBlifReader.h
+/// @brief BfoBlifReader のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/bfo_nsdef.h"
+#include "ym/BfoNetwork.h"
+#include <string_view>
+#include <unordered_map>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+/// @class BfoBlifReader BfoBlifReader.h "ym/BfoBlifReader.h"
+/// @brief BLIF 形式のファイルを読み込んで BfoNetwork を作るクラス
+///
+/// 組み合わせ回路のみを扱う．.latch, .subckt, .gate などは
+/// エラーとなる．複数の .model がある場合は最初のものだけを読む．<br>
+/// .names の各行はトークンを切り出した後，直接カバーの本体に
+/// 書き込むので，キューブごとに文字列を作ることはない．<br>
+/// 出力部が '0' の行(OFF-set による記述)はファンインを持たない
+/// 定数0の場合を除いて受け付けない．<br>
+/// ネットワークの AlgMgr の変数の数を超えるファンイン数の
+/// .names はエラーとなる．
+//////////////////////////////////////////////////////////////////////
+class BfoBlifReader
+{
+public:
+
+  /// @brief コンストラクタ
+  BfoBlifReader() = default;
+
+  /// @brief デストラクタ
+  ~BfoBlifReader() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ファイルを読み込む．
+  /// @return 読み込みが成功したら true を返す．
+  ///
+  /// network は空でなければならない．
+  /// 失敗した場合の network の内容は不定となる．
+  bool
+  read(
+    const string& filename, ///< [in] ファイル名
+    BfoNetwork& network     ///< [out] 結果を格納するネットワーク
+  );
+
+  /// @brief ストリームから読み込む．
+  /// @return 読み込みが成功したら true を返す．
+  ///
+  /// network は空でなければならない．
+  /// 失敗した場合の network の内容は不定となる．
+  bool
+  read(
+    istream& s,         ///< [in] 入力ストリーム
+    BfoNetwork& network ///< [out] 結果を格納するネットワーク
+  );
+
+  /// @brief .model で指定された名前を返す．
+  const string&
+  model_name() const
+  {
+    return mModelName;
+  }
+
+  /// @brief エラーメッセージを返す．
+  ///
+  /// read() が失敗した時のみ意味を持つ．
+  const string&
+  error_message() const
+  {
+    return mErrorMessage;
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 論理的な1行を読み込んでトークンに分ける．
+  /// @return ファイルの末尾に達したら false を返す．
+  ///
+  /// 空行とコメントは読み飛ばし，'\' で終わる行は次の行とつなげる．
+  /// トークンは mLine の中を指す．
+  bool
+  _read_line(
+    istream& s ///< [in] 入力ストリーム
+  );
+
+  /// @brief ドットで始まる行を処理する．
+  /// @return エラーがあったら false を返す．
+  bool
+  _read_command(
+    bool& end ///< [out] .end を読んだら true にする．
+  );
+
+  /// @brief .names の開始行を処理する．
+  /// @return エラーがあったら false を返す．
+  bool
+  _start_names();
+
+  /// @brief .names のキューブを表す行を処理する．
+  /// @return エラーがあったら false を返す．
+  bool
+  _read_cube();
+
+  /// @brief 読み込み中の .names を終える．
+  void
+  _end_names();
+
+  /// @brief 名前に対応するノード番号を返す．
+  ///
+  /// 未登録の場合は仮の論理ノードを作る．
+  SizeType
+  _find_node(
+    std::string_view name ///< [in] 名前
+  );
+
+  /// @brief エラーメッセージをセットする．
+  /// @return 常に false を返す．
+  bool
+  _error(
+    const string& msg ///< [in] メッセージ
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 対象のネットワーク
+  BfoNetwork* mNetwork{nullptr};
+
+  // .model 名
+  string mModelName;
+
+  // 名前をキーにしてノード番号を保持する表
+  std::unordered_map<string, SizeType> mNodeMap;
+
+  // 名前の検索用のバッファ
+  string mKey;
+
+  // ノードが定義済みの時 true となる配列
+  // ノード番号をキーにする．
+  vector<bool> mDefined;
+
+  // .outputs で指定された名前のリスト
+  vector<string> mOutputNameList;
+
+  // 現在の論理的な行
+  string mLine;
+
+  // 物理的な行のバッファ
+  string mBuff;
+
+  // mLine 中のトークンのリスト
+  vector<std::string_view> mTokenList;
+
+  // 現在の行番号
+  SizeType mLineNo{0};
+
+  // 読み込み中の .names の出力ノード番号
+  // .names の外では kBadId となる．
+  SizeType mCurId{kBadId};
+
+  // 読み込み中の .names のファンインのリスト
+  vector<SizeType> mFaninList;
+
+  // 読み込み中の .names のキューブの本体
+  vector<ymuint64> mCubeBuf;
+
+  // 読み込み中の .names のキューブ数
+  SizeType mCubeNum{0};
+
+  // 読み込み中の .names の出力部の値
+  // まだキューブを読んでいない時は '\0' となる．
+  char mOutVal{'\0'};
+
+  // エラーメッセージ
+  string mErrorMessage;
+
+  // 不正なノード番号
+  static
+  constexpr SizeType kBadId = static_cast<SizeType>(-1);
+
+};
+
+END_NAMESPACE_YM_BFO
+
+#endif // BFOBLIFREADER_H
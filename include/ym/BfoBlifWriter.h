@@ -0,0 +1,99 @@
+#ifndef BFOBLIFWRITER_H
+#define BFOBLIFWRITER_H
+
+/// @file BfoBlifWriter.h
+/// @brief BfoBlifWriter のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/bfo_nsdef.h"
+#include "ym/BfoNetwork.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+/// @class BfoBlifWriter BfoBlifWriter.h "ym/BfoBlifWriter.h"
+/// @brief BfoNetwork を BLIF 形式で書き出すクラス
+///
+/// BfoBlifReader と対になっている．<br>
+/// 論理ノードはトポロジカル順に .names として書き出し，
+/// 関数はキューブごとに1行の ON-set として書き出す．<br>
+/// 名前のないノードは "n<ノード番号>" という名前で書き出す．<br>
+/// 出力は一旦内部のバッファに溜めてからまとめて書き出す．
+//////////////////////////////////////////////////////////////////////
+class BfoBlifWriter
+{
+public:
+
+  /// @brief コンストラクタ
+  BfoBlifWriter(
+    const string& model_name = "bfo" ///< [in] .model 名
+  ) : mModelName{model_name}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~BfoBlifWriter() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ファイルに書き出す．
+  /// @return 書き出しが成功したら true を返す．
+  bool
+  write(
+    const string& filename,   ///< [in] ファイル名
+    const BfoNetwork& network ///< [in] 対象のネットワーク
+  );
+
+  /// @brief ストリームに書き出す．
+  void
+  write(
+    ostream& s,               ///< [in] 出力ストリーム
+    const BfoNetwork& network ///< [in] 対象のネットワーク
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ノード名をバッファに書き込む．
+  void
+  _put_name(
+    const BfoNetwork& network, ///< [in] 対象のネットワーク
+    SizeType id                ///< [in] ノード番号
+  );
+
+  /// @brief 必要ならバッファの内容を書き出す．
+  void
+  _flush(
+    ostream& s,        ///< [in] 出力ストリーム
+    bool force = false ///< [in] true の時は常に書き出す．
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // .model 名
+  string mModelName;
+
+  // 出力用のバッファ
+  string mBuff;
+
+};
+
+END_NAMESPACE_YM_BFO
+
+#endif // BFOBLIFWRITER_H
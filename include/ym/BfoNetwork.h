@@ -0,0 +1,382 @@
+#ifndef BFONETWORK_H
+#define BFONETWORK_H
+
+/// @file BfoNetwork.h
+/// @brief BfoNetwork のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "ym/bfo_nsdef.h"
+#include "ym/AlgCover.h"
+#include "ym/AlgMgr.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+//////////////////////////////////////////////////////////////////////
+/// @class BfoNetwork BfoNetwork.h "ym/BfoNetwork.h"
+/// @brief 積和形論理式(AlgCover)をノードの関数とする多段論理回路
+///
+/// ノードには外部入力ノードと論理ノードの2種類がある．
+/// 論理ノードの関数はファンインを変数とする AlgCover で表す．
+/// i 番目のファンインが変数番号 i に対応する．
+/// すべてのカバーは1つの AlgMgr を共有するので，ファンイン数は
+/// mgr().variable_num() 以下でなければならない．<br>
+/// 出力は(任意の種類の)ノード番号のリストで表す．<br>
+/// ノード番号は削除されても再利用されない．削除されたノードは
+/// is_valid() が false を返す．<br>
+/// 論理ノードのリテラル数の総和は関数を変更するたびに更新されるので
+/// literal_num() は定数時間で答えられる．
+//////////////////////////////////////////////////////////////////////
+class BfoNetwork
+{
+public:
+
+  /// @brief コンストラクタ
+  explicit
+  BfoNetwork(
+    AlgMgr& mgr ///< [in] マネージャ
+  ) : mMgr{mgr}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~BfoNetwork() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 全体の情報を取り出す関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief マネージャを返す．
+  AlgMgr&
+  mgr() const
+  {
+    return mMgr;
+  }
+
+  /// @brief ノード番号の上限を返す．
+  ///
+  /// 削除されたノードも含む．
+  SizeType
+  node_num() const
+  {
+    return mNodeList.size();
+  }
+
+  /// @brief 外部入力ノードのリストを返す．
+  const vector<SizeType>&
+  input_list() const
+  {
+    return mInputList;
+  }
+
+  /// @brief 出力ノードのリストを返す．
+  const vector<SizeType>&
+  output_list() const
+  {
+    return mOutputList;
+  }
+
+  /// @brief 論理ノードの数を返す．
+  ///
+  /// 削除されたノードは含まない．
+  SizeType
+  logic_num() const
+  {
+    return mLogicNum;
+  }
+
+  /// @brief 論理ノードのリテラル数の総和を返す．
+  SizeType
+  literal_num() const
+  {
+    return mLiteralNum;
+  }
+
+  /// @brief 論理ノードをトポロジカル順に並べる．
+  /// @return ループがあった場合は false を返す．
+  ///
+  /// 入力側のノードが先に現れる．
+  bool
+  topological_order(
+    vector<SizeType>& node_list ///< [out] 結果の論理ノードのリスト
+  ) const;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // ノードの情報を取り出す関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ノードが有効な時 true を返す．
+  ///
+  /// 削除されたノードは無効となる．
+  bool
+  is_valid(
+    SizeType id ///< [in] ノード番号 ( 0 <= id < node_num() )
+  ) const
+  {
+    ASSERT_COND( id < node_num() );
+    return mNodeList[id].mType != kDeleted;
+  }
+
+  /// @brief 外部入力ノードの時 true を返す．
+  bool
+  is_input(
+    SizeType id ///< [in] ノード番号 ( 0 <= id < node_num() )
+  ) const
+  {
+    return _node(id).mType == kInput;
+  }
+
+  /// @brief 論理ノードの時 true を返す．
+  bool
+  is_logic(
+    SizeType id ///< [in] ノード番号 ( 0 <= id < node_num() )
+  ) const
+  {
+    return _node(id).mType == kLogic;
+  }
+
+  /// @brief ノード名を返す．
+  const string&
+  name(
+    SizeType id ///< [in] ノード番号 ( 0 <= id < node_num() )
+  ) const
+  {
+    return _node(id).mName;
+  }
+
+  /// @brief ファンインのノード番号のリストを返す．
+  ///
+  /// 外部入力ノードの場合は空となる．
+  const vector<SizeType>&
+  fanin_list(
+    SizeType id ///< [in] ノード番号 ( 0 <= id < node_num() )
+  ) const
+  {
+    return _node(id).mFaninList;
+  }
+
+  /// @brief ファンアウトのノード番号のリストを返す．
+  ///
+  /// 出力としての参照は含まない．
+  const vector<SizeType>&
+  fanout_list(
+    SizeType id ///< [in] ノード番号 ( 0 <= id < node_num() )
+  ) const
+  {
+    return _node(id).mFanoutList;
+  }
+
+  /// @brief 論理ノードの関数を返す．
+  const AlgCover&
+  function(
+    SizeType id ///< [in] ノード番号 ( 0 <= id < node_num() )
+  ) const
+  {
+    ASSERT_COND( is_logic(id) );
+    return _node(id).mFunction;
+  }
+
+  /// @brief 論理ノードのリテラル数を返す．
+  ///
+  /// 外部入力ノードの場合は 0 を返す．
+  SizeType
+  literal_num(
+    SizeType id ///< [in] ノード番号 ( 0 <= id < node_num() )
+  ) const
+  {
+    return _node(id).mLiteralNum;
+  }
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 内容を変更する関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 外部入力ノードを作る．
+  /// @return 作成したノード番号を返す．
+  SizeType
+  new_input(
+    const string& name = {} ///< [in] ノード名
+  );
+
+  /// @brief 論理ノードを作る．
+  /// @return 作成したノード番号を返す．
+  ///
+  /// 関数は定数0となる．ファンインが後から定まる場合に用いる．
+  SizeType
+  new_logic(
+    const string& name = {} ///< [in] ノード名
+  );
+
+  /// @brief 論理ノードを作る．
+  /// @return 作成したノード番号を返す．
+  SizeType
+  new_logic(
+    const vector<SizeType>& fanin_list, ///< [in] ファンインのノード番号のリスト
+    AlgCover&& func,                    ///< [in] 関数
+    const string& name = {}             ///< [in] ノード名
+  )
+  {
+    SizeType id = new_logic(name);
+    set_function(id, fanin_list, std::move(func));
+    return id;
+  }
+
+  /// @brief 論理ノードの関数を変更する．
+  ///
+  /// func の変数 i が fanin_list[i] に対応する．
+  /// 以前のファンインとの接続は取り除かれる．
+  void
+  set_function(
+    SizeType id,                        ///< [in] 対象のノード番号
+    const vector<SizeType>& fanin_list, ///< [in] ファンインのノード番号のリスト
+    AlgCover&& func                     ///< [in] 関数
+  );
+
+  /// @brief 論理ノードの関数を変更する．
+  void
+  set_function(
+    SizeType id,                        ///< [in] 対象のノード番号
+    const vector<SizeType>& fanin_list, ///< [in] ファンインのノード番号のリスト
+    const AlgCover& func                ///< [in] 関数
+  )
+  {
+    set_function(id, fanin_list, AlgCover{func});
+  }
+
+  /// @brief ノードを出力として登録する．
+  void
+  add_output(
+    SizeType id ///< [in] ノード番号
+  )
+  {
+    ASSERT_COND( is_valid(id) );
+    mOutputList.push_back(id);
+  }
+
+  /// @brief ノードを置き換える．
+  ///
+  /// old_id のファンアウトと出力としての参照をすべて new_id に付け替える．
+  /// old_id 自身は削除しない．<br>
+  /// new_id が old_id の推移的ファンアウトに含まれてはいけない．
+  void
+  substitute(
+    SizeType old_id, ///< [in] 置き換えられるノード番号
+    SizeType new_id  ///< [in] 置き換えるノード番号
+  );
+
+  /// @brief ノードを削除する．
+  ///
+  /// ファンアウトを持つノードや出力のノードは削除できない．
+  void
+  delete_node(
+    SizeType id ///< [in] ノード番号
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  // ノードの種類
+  enum Type {
+    kInput,
+    kLogic,
+    kDeleted
+  };
+
+  // ノード
+  struct Node
+  {
+    // コンストラクタ
+    Node(
+      Type type,
+      const string& name,
+      AlgMgr& mgr
+    ) : mType{type},
+	mName{name},
+	mFunction{mgr}
+    {
+    }
+
+    // 種類
+    Type mType;
+
+    // 名前
+    string mName;
+
+    // ファンインのリスト
+    vector<SizeType> mFaninList;
+
+    // ファンアウトのリスト
+    vector<SizeType> mFanoutList;
+
+    // 関数
+    AlgCover mFunction;
+
+    // mFunction のリテラル数
+    SizeType mLiteralNum{0};
+  };
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 有効なノードを取り出す．
+  const Node&
+  _node(
+    SizeType id ///< [in] ノード番号
+  ) const
+  {
+    ASSERT_COND( is_valid(id) );
+    return mNodeList[id];
+  }
+
+  /// @brief ファンインとの接続を取り除く．
+  void
+  _disconnect_fanins(
+    SizeType id ///< [in] ノード番号
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // マネージャ
+  AlgMgr& mMgr;
+
+  // ノードのリスト
+  // ノード番号をキーにする．
+  vector<Node> mNodeList;
+
+  // 外部入力のリスト
+  vector<SizeType> mInputList;
+
+  // 出力のリスト
+  vector<SizeType> mOutputList;
+
+  // 有効な論理ノード数
+  SizeType mLogicNum{0};
+
+  // 論理ノードのリテラル数の総和
+  SizeType mLiteralNum{0};
+
+};
+
+END_NAMESPACE_YM_BFO
+
+#endif // BFONETWORK_H
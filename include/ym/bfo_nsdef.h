@@ -39,7 +39,19 @@ class AlgLitSet;
 class AlgCube;
 class AlgCover;
 class AlgKernel;
+class AlgFastExtract;
+class AlgPlaReader;
+class AlgPlaWriter;
+class AlgCoverView;
+class AlgCoverFile;
+class AlgBitPlane;
+class AlgCoverTable;
+class AlgExpr;
+class AlgFactorGen;
 class AlgMgr;
+class BfoNetwork;
+class BfoBlifReader;
+class BfoBlifWriter;
 
 END_NAMESPACE_YM_BFO
 
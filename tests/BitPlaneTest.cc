@@ -0,0 +1,120 @@
+
+/// @file BitPlaneTest.cc
+/// @brief AlgBitPlane のテストプログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "gtest/gtest.h"
+#include "ym/AlgBitPlane.h"
+#include "ym/AlgMgr.h"
+#include <random>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+TEST(BitPlaneTest, convert)
+{
+  AlgMgr mgr(vector<string>{"a", "b", "c", "d"});
+  AlgCover src(mgr, "a b + a' c + b d'");
+
+  AlgBitPlane bp(src);
+  EXPECT_EQ( 4, bp.variable_num() );
+  EXPECT_EQ( 3, bp.cube_num() );
+  EXPECT_EQ( 1, bp.plane_size() );
+  EXPECT_EQ( src.literal_num(), bp.literal_num() );
+  EXPECT_EQ( src, bp.to_cover() );
+
+  for ( SizeType var = 0; var < 4; ++ var ) {
+    for ( bool inv: {false, true} ) {
+      AlgLiteral lit(var, inv);
+      EXPECT_EQ( src.literal_num(lit), bp.literal_num(lit) );
+      vector<SizeType> exp_list;
+      AlgPol pol = inv ? kAlgPolN : kAlgPolP;
+      for ( SizeType i = 0; i < src.cube_num(); ++ i ) {
+	if ( src.literal(i, var) == pol ) {
+	  exp_list.push_back(i);
+	}
+      }
+      EXPECT_EQ( exp_list, bp.cube_list(lit) );
+    }
+  }
+}
+
+TEST(BitPlaneTest, empty)
+{
+  AlgMgr mgr(10);
+  AlgCover src(mgr);
+
+  AlgBitPlane bp(src);
+  EXPECT_EQ( 0, bp.cube_num() );
+  EXPECT_EQ( 0, bp.literal_num() );
+  EXPECT_EQ( src, bp.to_cover() );
+  EXPECT_EQ( AlgCube(mgr), bp.common_cube() );
+}
+
+TEST(BitPlaneTest, common_cube)
+{
+  AlgMgr mgr(vector<string>{"a", "b", "c", "d"});
+  AlgCover src(mgr, "a b' c + a b' d + a b' c' d'");
+
+  AlgBitPlane bp(src);
+  EXPECT_EQ( AlgCube(mgr, "a b'"), bp.common_cube() );
+  EXPECT_EQ( src.common_cube(), bp.common_cube() );
+}
+
+TEST(BitPlaneTest, division)
+{
+  AlgMgr mgr(vector<string>{"a", "b", "c", "d"});
+  AlgCover src(mgr, "a b + a' c + a d + b d'");
+
+  AlgBitPlane bp(src);
+  for ( SizeType var = 0; var < 4; ++ var ) {
+    for ( bool inv: {false, true} ) {
+      AlgLiteral lit(var, inv);
+      EXPECT_EQ( src / lit, bp / lit );
+    }
+  }
+}
+
+TEST(BitPlaneTest, large)
+{
+  // 複数ワードのプレーンと複数ワードのキューブの場合
+  SizeType nv = 70;
+  SizeType nc = 150;
+  AlgMgr mgr(nv);
+  std::mt19937 rg;
+  std::uniform_int_distribution<int> rd(0, 5);
+  vector<AlgCube> cube_list;
+  for ( SizeType i = 0; i < nc; ++ i ) {
+    vector<AlgLiteral> lit_list;
+    for ( SizeType var = 0; var < nv - 1; ++ var ) {
+      int r = rd(rg);
+      if ( r == 0 ) {
+	lit_list.push_back(AlgLiteral(var, false));
+      }
+      else if ( r == 1 ) {
+	lit_list.push_back(AlgLiteral(var, true));
+      }
+    }
+    // 全キューブに共通なリテラルを入れておく．
+    lit_list.push_back(AlgLiteral(nv - 1, false));
+    cube_list.push_back(AlgCube(mgr, lit_list));
+  }
+  AlgCover src(mgr, cube_list);
+
+  AlgBitPlane bp(src);
+  EXPECT_EQ( AlgMgr::plane_size(src.cube_num()), bp.plane_size() );
+  EXPECT_EQ( src, bp.to_cover() );
+  EXPECT_EQ( src.literal_num(), bp.literal_num() );
+  EXPECT_EQ( src.common_cube(), bp.common_cube() );
+  for ( SizeType var = 0; var < nv; ++ var ) {
+    AlgLiteral lit(var, false);
+    EXPECT_EQ( src.literal_num(lit), bp.literal_num(lit) );
+    EXPECT_EQ( src / lit, bp / lit );
+  }
+}
+
+END_NAMESPACE_YM_BFO
@@ -0,0 +1,220 @@
+
+/// @file BlifTest.cc
+/// @brief BfoBlifReader/BfoBlifWriter のテストプログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "gtest/gtest.h"
+#include "ym/BfoBlifReader.h"
+#include "ym/BfoBlifWriter.h"
+#include "ym/AlgMgr.h"
+#include <sstream>
+#include <chrono>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+TEST(BlifTest, read1)
+{
+  std::istringstream s{
+    "# comment\n"
+    ".model test\n"
+    ".inputs a b \\\n"
+    "  c\n"
+    ".outputs f\n"
+    ".names g c f\n"
+    "1- 1\n"
+    "-0 1\n"
+    ".names a b g  # 後ろのコメント\n"
+    "11 1\n"
+    ".end\n"
+  };
+
+  AlgMgr mgr(4);
+  BfoNetwork network(mgr);
+  BfoBlifReader reader;
+  ASSERT_TRUE( reader.read(s, network) ) << reader.error_message();
+
+  EXPECT_EQ( "test", reader.model_name() );
+  ASSERT_EQ( 3, network.input_list().size() );
+  EXPECT_EQ( "c", network.name(network.input_list()[2]) );
+  ASSERT_EQ( 1, network.output_list().size() );
+  SizeType f = network.output_list()[0];
+  EXPECT_EQ( "f", network.name(f) );
+  EXPECT_EQ( 2, network.logic_num() );
+  EXPECT_EQ( 4, network.literal_num() );
+
+  auto& fanin_list = network.fanin_list(f);
+  ASSERT_EQ( 2, fanin_list.size() );
+  SizeType g = fanin_list[0];
+  EXPECT_EQ( "g", network.name(g) );
+  EXPECT_EQ( AlgCover(mgr, "a + b'"), network.function(f) );
+  EXPECT_EQ( AlgCover(mgr, "a b"), network.function(g) );
+
+  vector<SizeType> node_list;
+  EXPECT_TRUE( network.topological_order(node_list) );
+  EXPECT_EQ( (vector<SizeType>{g, f}), node_list );
+}
+
+TEST(BlifTest, constant)
+{
+  std::istringstream s{
+    ".model const\n"
+    ".outputs one zero1 zero2\n"
+    ".names one\n"
+    "1\n"
+    ".names zero1\n"
+    ".names zero2\n"
+    "0\n"
+    ".end\n"
+  };
+
+  AlgMgr mgr(4);
+  BfoNetwork network(mgr);
+  BfoBlifReader reader;
+  ASSERT_TRUE( reader.read(s, network) ) << reader.error_message();
+
+  auto& output_list = network.output_list();
+  ASSERT_EQ( 3, output_list.size() );
+  EXPECT_EQ( AlgCover(mgr, 0), network.function(output_list[0]) );
+  EXPECT_EQ( AlgCover(mgr), network.function(output_list[1]) );
+  EXPECT_EQ( AlgCover(mgr), network.function(output_list[2]) );
+}
+
+TEST(BlifTest, read_error)
+{
+  vector<pair<string, string>> data_list{
+    {".inputs a\n.outputs f\n.names a f\n1 1\n.latch a f\n", "line 5: .latch: not supported"},
+    {".inputs a\n.outputs f\n.names a f\n0 0\n", "line 4: OFF-set description is not supported"},
+    {".inputs a\n.outputs f\n.names a f\n11 1\n", "line 4: the size of input part does not match"},
+    {".inputs a\n.outputs f\n.names a f\nx 1\n", "line 4: illegal character 'x' in input part"},
+    {".inputs a\n.outputs f\n.names a f\n1 1\n.names a f\n1 1\n", "line 5: f: defined more than once"},
+    {".inputs a\n.outputs f\n.names a b f\n11 1\n", "b: undefined"},
+    {".inputs a\n.outputs f g\n.names a f\n1 1\n", "g: undefined"},
+    {".inputs a b c d e\n.outputs f\n.names a b c d e f\n11111 1\n", "line 3: too many fanins"},
+    {"11 1\n", "line 1: unexpected line"},
+  };
+  for ( auto& data: data_list ) {
+    std::istringstream s{data.first};
+    AlgMgr mgr(4);
+    BfoNetwork network(mgr);
+    BfoBlifReader reader;
+    EXPECT_FALSE( reader.read(s, network) );
+    EXPECT_EQ( data.second, reader.error_message() );
+  }
+}
+
+TEST(BlifTest, forward_input)
+{
+  // .inputs より前に参照されている場合
+  std::istringstream s{
+    ".outputs f\n"
+    ".names a f\n"
+    "0 1\n"
+    ".inputs a\n"
+  };
+
+  AlgMgr mgr(4);
+  BfoNetwork network(mgr);
+  BfoBlifReader reader;
+  ASSERT_TRUE( reader.read(s, network) ) << reader.error_message();
+
+  ASSERT_EQ( 1, network.input_list().size() );
+  SizeType a = network.input_list()[0];
+  SizeType f = network.output_list()[0];
+  EXPECT_EQ( vector<SizeType>{a}, network.fanin_list(f) );
+  EXPECT_EQ( vector<SizeType>{f}, network.fanout_list(a) );
+  EXPECT_EQ( 1, network.logic_num() );
+}
+
+TEST(BlifTest, write1)
+{
+  AlgMgr mgr(vector<string>{"a", "b", "c"});
+  BfoNetwork network(mgr);
+  SizeType x = network.new_input("x");
+  SizeType y = network.new_input("y");
+  SizeType g = network.new_logic({x, y}, AlgCover(mgr, "a b' + a' b"));
+  SizeType f = network.new_logic({g, x}, AlgCover(mgr, "a + b"), "f");
+  SizeType c = network.new_logic({}, AlgCover(mgr, 0), "one");
+  network.add_output(f);
+  network.add_output(c);
+
+  std::ostringstream s;
+  BfoBlifWriter writer{"test"};
+  writer.write(s, network);
+  string exp_str =
+    ".model test\n"
+    ".inputs x y\n"
+    ".outputs f one\n"
+    ".names one\n"
+    "1\n"
+    ".names x y n2\n"
+    "10 1\n"
+    "01 1\n"
+    ".names n2 x f\n"
+    "1- 1\n"
+    "-1 1\n"
+    ".end\n";
+  EXPECT_EQ( exp_str, s.str() );
+
+  // 読み直すと同じ関数になる．
+  std::istringstream s2{s.str()};
+  AlgMgr mgr2(vector<string>{"a", "b", "c"});
+  BfoNetwork network2(mgr2);
+  BfoBlifReader reader;
+  ASSERT_TRUE( reader.read(s2, network2) ) << reader.error_message();
+  EXPECT_EQ( network.literal_num(), network2.literal_num() );
+  SizeType f2 = network2.output_list()[0];
+  EXPECT_EQ( AlgCover(mgr2, "a + b"), network2.function(f2) );
+}
+
+TEST(BlifTest, large)
+{
+  // 100万ノードの BLIF の読み書きにかかる時間を測る．
+  const SizeType ni = 1000;
+  const SizeType nn = 1000000;
+  std::ostringstream buf;
+  buf << ".model large\n"
+      << ".inputs";
+  for ( SizeType i = 0; i < ni; ++ i ) {
+    buf << " n" << i;
+  }
+  buf << "\n.outputs n" << (ni + nn - 1) << "\n";
+  for ( SizeType i = ni; i < ni + nn; ++ i ) {
+    // 直前の2つのノードと少し離れたノードをファンインにする．
+    buf << ".names n" << (i - 1) << " n" << (i - 2) << " n" << (i - ni) << " n" << i << "\n"
+	<< "11- 1\n"
+	<< "0-1 1\n";
+  }
+  buf << ".end\n";
+  string text = buf.str();
+
+  AlgMgr mgr(4);
+  BfoNetwork network(mgr);
+  BfoBlifReader reader;
+  std::istringstream s{text};
+  auto t0 = std::chrono::steady_clock::now();
+  ASSERT_TRUE( reader.read(s, network) ) << reader.error_message();
+  auto t1 = std::chrono::steady_clock::now();
+  EXPECT_EQ( ni, network.input_list().size() );
+  EXPECT_EQ( nn, network.logic_num() );
+  EXPECT_EQ( nn * 4, network.literal_num() );
+
+  std::ostringstream s2;
+  BfoBlifWriter writer{"large"};
+  auto t2 = std::chrono::steady_clock::now();
+  writer.write(s2, network);
+  auto t3 = std::chrono::steady_clock::now();
+  EXPECT_EQ( text.size(), s2.str().size() );
+
+  auto msec = [](auto d) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(d).count();
+  };
+  RecordProperty("read_msec", static_cast<int>(msec(t1 - t0)));
+  RecordProperty("write_msec", static_cast<int>(msec(t3 - t2)));
+}
+
+END_NAMESPACE_YM_BFO
@@ -0,0 +1,218 @@
+
+/// @file CoverFileTest.cc
+/// @brief AlgCoverFile のテストプログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "gtest/gtest.h"
+#include "ym/AlgCoverFile.h"
+#include "ym/AlgMgr.h"
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <cstdio>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+class CoverFileTest :
+  public ::testing::Test
+{
+public:
+
+  /// @brief コンストラクタ
+  CoverFileTest() :
+    mMgr(vector<string>{"x", "y", "z", "w"}),
+    mFilename{::testing::TempDir() + "bfo_cover_file_test.bin"}
+  {
+  }
+
+  /// @brief 終了処理
+  void
+  TearDown() override
+  {
+    std::remove(mFilename.c_str());
+  }
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief マネージャを返す．
+  AlgMgr&
+  mgr() { return mMgr; }
+
+  /// @brief ファイル名を返す．
+  const string&
+  filename() const { return mFilename; }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // マネージャ
+  AlgMgr mMgr;
+
+  // テスト用のファイル名
+  string mFilename;
+
+};
+
+
+TEST_F(CoverFileTest, write_open)
+{
+  vector<AlgCover> cover_list{
+    AlgCover(mgr(), "x y + z' w"),
+    AlgCover(mgr()),
+    AlgCover(mgr(), "x' + y z w")
+  };
+  ASSERT_TRUE( AlgCoverFile::write(filename(), cover_list) );
+
+  AlgCoverFile file;
+  ASSERT_TRUE( file.open(filename()) );
+  EXPECT_TRUE( file.verify() );
+
+  auto& mgr2 = file.mgr();
+  ASSERT_EQ( 4, mgr2.variable_num() );
+  EXPECT_EQ( "x", mgr2.varname(0) );
+  EXPECT_EQ( "w", mgr2.varname(3) );
+
+  ASSERT_EQ( 3, file.cover_num() );
+  for ( SizeType i = 0; i < 3; ++ i ) {
+    auto view = file.cover(i);
+    EXPECT_TRUE( view.is_sorted() );
+    EXPECT_EQ( cover_list[i].cube_num(), view.cube_num() );
+    EXPECT_EQ( cover_list[i].literal_num(), view.literal_num() );
+    EXPECT_EQ( cover_list[i].hash(), view.hash() );
+  }
+  EXPECT_EQ( AlgCover(mgr2, "x y + z' w"), file.cover(0).to_cover() );
+  EXPECT_TRUE( file.cover(2) == AlgCover(mgr2, "x' + y z w") );
+  EXPECT_EQ( 1, file.cover(2).literal_num(AlgLiteral(0, true)) );
+
+  file.close();
+  EXPECT_EQ( 0, file.cover_num() );
+}
+
+TEST_F(CoverFileTest, load_time)
+{
+  // 約 12MB のファイルを開く時間を，同じカバーを文字列から
+  // 作り直す時間と比べる．
+  AlgMgr mgr(100);
+  ymuint64 seed = 1;
+  vector<AlgCover> cover_list;
+  for ( SizeType i = 0; i < 200; ++ i ) {
+    vector<AlgCube> cube_list;
+    for ( SizeType j = 0; j < 2000; ++ j ) {
+      vector<AlgLiteral> lit_list;
+      for ( SizeType var = 0; var < 100; ++ var ) {
+	seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+	SizeType r = (seed >> 33) % 8;
+	if ( r < 2 ) {
+	  lit_list.push_back(AlgLiteral(var, r == 1));
+	}
+      }
+      cube_list.push_back(AlgCube(mgr, lit_list));
+    }
+    cover_list.push_back(AlgCover(mgr, cube_list));
+  }
+  ASSERT_TRUE( AlgCoverFile::write(filename(), cover_list) );
+
+  vector<string> str_list;
+  for ( auto& cover: cover_list ) {
+    std::ostringstream buf;
+    cover.print(buf);
+    str_list.push_back(buf.str());
+  }
+
+  auto usec = [](auto d) {
+    return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(d).count());
+  };
+
+  AlgCoverFile file;
+  auto t0 = std::chrono::steady_clock::now();
+  ASSERT_TRUE( file.open(filename()) );
+  auto t1 = std::chrono::steady_clock::now();
+  EXPECT_TRUE( file.verify() );
+  auto t2 = std::chrono::steady_clock::now();
+  ASSERT_EQ( cover_list.size(), file.cover_num() );
+  for ( SizeType i = 0; i < cover_list.size(); ++ i ) {
+    auto view = file.cover(i);
+    EXPECT_EQ( cover_list[i].cube_num(), view.cube_num() );
+    EXPECT_EQ( cover_list[i].hash(), view.hash() );
+  }
+
+  auto t3 = std::chrono::steady_clock::now();
+  vector<AlgCover> parsed_list;
+  for ( auto& str: str_list ) {
+    parsed_list.push_back(AlgCover(mgr, str));
+  }
+  auto t4 = std::chrono::steady_clock::now();
+  EXPECT_EQ( cover_list, parsed_list );
+
+  RecordProperty("open_usec", usec(t1 - t0));
+  RecordProperty("verify_usec", usec(t2 - t1));
+  RecordProperty("parse_usec", usec(t4 - t3));
+}
+
+TEST_F(CoverFileTest, checksum)
+{
+  vector<AlgCover> cover_list{
+    AlgCover(mgr(), "x y + z' w")
+  };
+  ASSERT_TRUE( AlgCoverFile::write(filename(), cover_list) );
+
+  // 本体の最後のワードを書き換える．
+  {
+    std::fstream s{filename(), std::ios::in | std::ios::out | std::ios::binary};
+    s.seekp(-1, std::ios::end);
+    s.put('\x55');
+  }
+
+  AlgCoverFile file;
+  ASSERT_TRUE( file.open(filename()) );
+  EXPECT_FALSE( file.verify() );
+}
+
+TEST_F(CoverFileTest, bad_file)
+{
+  {
+    std::ofstream s{filename()};
+    s << "this is not a cover file, but long enough to hold a header.";
+  }
+
+  AlgCoverFile file;
+  EXPECT_FALSE( file.open(filename()) );
+  EXPECT_EQ( filename() + ": not a cover file", file.error_message() );
+
+  EXPECT_FALSE( file.open(filename() + ".none") );
+  EXPECT_EQ( filename() + ".none: No such file", file.error_message() );
+}
+
+TEST_F(CoverFileTest, broken_var_num)
+{
+  vector<AlgCover> cover_list{
+    AlgCover(mgr(), "x y + z' w")
+  };
+  ASSERT_TRUE( AlgCoverFile::write(filename(), cover_list) );
+
+  // ヘッダの変数の数(4ワード目)を巨大な値に書き換える．
+  {
+    std::fstream s{filename(), std::ios::in | std::ios::out | std::ios::binary};
+    s.seekp(3 * sizeof(ymuint64));
+    ymuint64 var_num = ~0ULL >> 4;
+    s.write(reinterpret_cast<const char*>(&var_num), sizeof(var_num));
+  }
+
+  AlgCoverFile file;
+  EXPECT_FALSE( file.open(filename()) );
+  EXPECT_EQ( filename() + ": broken header", file.error_message() );
+}
+
+END_NAMESPACE_YM_BFO
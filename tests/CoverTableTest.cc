@@ -0,0 +1,67 @@
+
+/// @file CoverTableTest.cc
+/// @brief AlgCoverTable のテストプログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "gtest/gtest.h"
+#include "ym/AlgCoverTable.h"
+#include "ym/AlgMgr.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+TEST(CoverTableTest, intern)
+{
+  AlgMgr mgr(vector<string>{"a", "b", "c", "d"});
+  AlgCoverTable table(mgr);
+
+  AlgCover cover1(mgr, "a b + c");
+  auto p1 = table.intern(cover1);
+  EXPECT_EQ( cover1, *p1 );
+  EXPECT_EQ( 1, table.size() );
+
+  // 同じ内容なら同じものが返る．
+  auto p2 = table.intern(AlgCover(mgr, "c + b a"));
+  EXPECT_EQ( p1, p2 );
+  EXPECT_EQ( 1, table.size() );
+
+  // 異なる内容なら別のもの
+  auto p3 = table.intern(AlgCover(mgr, "a b + d"));
+  EXPECT_NE( p1, p3 );
+  EXPECT_EQ( AlgCover(mgr, "a b + d"), *p3 );
+  EXPECT_EQ( 2, table.size() );
+}
+
+TEST(CoverTableTest, release)
+{
+  AlgMgr mgr(vector<string>{"a", "b", "c", "d"});
+  AlgCoverTable table(mgr);
+
+  auto p1 = table.intern(AlgCover(mgr, "a b + c"));
+  {
+    auto p2 = table.intern(AlgCover(mgr, "a + d'"));
+    EXPECT_EQ( 2, table.size() );
+  }
+  // p2 の参照がなくなったので数に含まれない．
+  EXPECT_EQ( 1, table.size() );
+  table.purge();
+  EXPECT_EQ( 1, table.size() );
+
+  // 解放されたものは新たに作られる．
+  auto p3 = table.intern(AlgCover(mgr, "a + d'"));
+  EXPECT_EQ( AlgCover(mgr, "a + d'"), *p3 );
+  EXPECT_EQ( 2, table.size() );
+
+  // clear() しても返したものは使える．
+  table.clear();
+  EXPECT_EQ( 0, table.size() );
+  EXPECT_EQ( AlgCover(mgr, "a b + c"), *p1 );
+  auto p4 = table.intern(AlgCover(mgr, "a b + c"));
+  EXPECT_NE( p1, p4 );
+}
+
+END_NAMESPACE_YM_BFO
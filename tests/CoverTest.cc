@@ -317,6 +317,39 @@ TEST_F(CoverTest, from_bad_string)
   EXPECT_EQ( 0, cover.literal_num() );
 }
 
+TEST_F(CoverTest, literal_histogram)
+{
+  AlgCover cover(mgr(), "a b + a c' + a' b + d");
+
+  auto hist = cover.literal_histogram();
+  ASSERT_EQ( mgr().variable_num() * 2, hist.size() );
+  EXPECT_EQ( 2, hist[AlgLiteral(0, false).index()] );
+  EXPECT_EQ( 1, hist[AlgLiteral(0, true).index()] );
+  EXPECT_EQ( 2, hist[AlgLiteral(1, false).index()] );
+  EXPECT_EQ( 0, hist[AlgLiteral(1, true).index()] );
+  EXPECT_EQ( 0, hist[AlgLiteral(2, false).index()] );
+  EXPECT_EQ( 1, hist[AlgLiteral(2, true).index()] );
+  EXPECT_EQ( 1, hist[AlgLiteral(3, false).index()] );
+  for ( ymuint i = 4; i < mgr().variable_num(); ++ i ) {
+    EXPECT_EQ( 0, hist[AlgLiteral(i, false).index()] );
+    EXPECT_EQ( 0, hist[AlgLiteral(i, true).index()] );
+  }
+}
+
+TEST_F(CoverTest, literal_list_by_frequency)
+{
+  AlgCover cover(mgr(), "a b + a c' + a d + a' b + b d + e");
+
+  // 出現回数の昇順，同じ回数なら index() の昇順
+  EXPECT_EQ( (vector<AlgLiteral>{AlgLiteral(3, false), AlgLiteral(0, false),
+				 AlgLiteral(1, false)}),
+	     cover.literal_list_by_frequency() );
+  EXPECT_EQ( (vector<AlgLiteral>{AlgLiteral(0, false), AlgLiteral(1, false)}),
+	     cover.literal_list_by_frequency(3) );
+  EXPECT_EQ( 6, cover.literal_list_by_frequency(1).size() );
+  EXPECT_EQ( AlgLiteral(0, true), cover.literal_list_by_frequency(1)[0] );
+}
+
 TEST_F(CoverTest, sort2_1)
 {
   const char* str = "a + b";
@@ -889,6 +922,86 @@ TEST_F(CoverTest, bin_division3)
   EXPECT_EQ( AlgCover(mgr(), "a c"), cover5);
 }
 
+TEST_F(CoverTest, div_rem1)
+{
+  AlgCover cover1(mgr(), "a c + a d + b c + b d + e");
+  AlgCover cover2(mgr(), "a + b");
+
+  auto p = cover1.div_rem(cover2);
+
+  EXPECT_EQ( AlgCover(mgr(), "c + d"), p.first );
+  EXPECT_EQ( AlgCover(mgr(), "e"), p.second );
+}
+
+TEST_F(CoverTest, div_rem2)
+{
+  // 商が空の場合は剰余は被除数そのもの
+  AlgCover cover1(mgr(), "a b + a c + b c");
+  AlgCover cover2(mgr(), "b + c'");
+
+  auto p = cover1.div_rem(cover2);
+
+  EXPECT_EQ( AlgCover(mgr(), ""), p.first );
+  EXPECT_EQ( cover1, p.second );
+}
+
+TEST_F(CoverTest, div_rem3)
+{
+  // 商は除数と共通の変数を含まない．
+  // (a b は b * a とは見なさない)
+  AlgCover cover1(mgr(), "a b + a + b");
+  AlgCover cover2(mgr(), "a + b");
+
+  auto p = cover1.div_rem(cover2);
+
+  EXPECT_EQ( AlgCover(mgr(), 1), p.first );
+  EXPECT_EQ( AlgCover(mgr(), "a b"), p.second );
+}
+
+TEST_F(CoverTest, div_rem4)
+{
+  // 多数のキューブを持つ場合
+  // f = d * q + r の形のカバーを作る．
+  vector<string> d_list;
+  for ( int i = 0; i < 5; ++ i ) {
+    d_list.push_back(mgr().varname(i));
+  }
+  vector<string> q_list;
+  for ( int i = 6; i < 30; ++ i ) {
+    q_list.push_back(mgr().varname(5) + " " + mgr().varname(i));
+  }
+  q_list.push_back(mgr().varname(6) + "' " + mgr().varname(7));
+  string r_str = mgr().varname(0) + " " + mgr().varname(6) + "'";
+  string d_str;
+  for ( auto& d1: d_list ) {
+    if ( d_str != "" ) {
+      d_str += " + ";
+    }
+    d_str += d1;
+  }
+  string q_str;
+  string f_str = r_str;
+  for ( auto& q1: q_list ) {
+    if ( q_str != "" ) {
+      q_str += " + ";
+    }
+    q_str += q1;
+    for ( auto& d1: d_list ) {
+      f_str += " + " + q1 + " " + d1;
+    }
+  }
+  AlgCover d(mgr(), d_str);
+  AlgCover q(mgr(), q_str);
+  AlgCover r(mgr(), r_str);
+  AlgCover f(mgr(), f_str);
+
+  auto p = f.div_rem(d);
+
+  EXPECT_EQ( q, p.first );
+  EXPECT_EQ( r, p.second );
+  EXPECT_EQ( q, f / d );
+}
+
 TEST_F(CoverTest, int_division_c1)
 {
   AlgCover cover1(mgr(), "a b + a c + b c");
@@ -1007,6 +1120,89 @@ TEST_F(CoverTest, common_cube2)
   EXPECT_EQ( AlgCube(mgr(), ""), ccube );
 }
 
+TEST_F(CoverTest, constructor_dup1)
+{
+  // 重複したキューブは取り除かれる．
+  AlgCover cover(mgr(), "a b + c + a b + c + d");
+
+  EXPECT_EQ( 3, cover.cube_num() );
+  EXPECT_EQ( AlgCover(mgr(), "a b + c + d"), cover );
+}
+
+TEST_F(CoverTest, move1)
+{
+  AlgCover cover1(mgr(), "a b + a c + b d");
+  AlgCover cover2(cover1);
+
+  SizeType n0 = mgr().alloc_stats().alloc_num;
+  AlgCover cover3(std::move(cover1));
+  EXPECT_EQ( n0, mgr().alloc_stats().alloc_num );
+  EXPECT_EQ( cover2, cover3 );
+  // ムーブ元は空のカバーになる．
+  EXPECT_EQ( 0, cover1.cube_num() );
+
+  AlgCover cover4(mgr(), "a + b");
+  n0 = mgr().alloc_stats().alloc_num;
+  cover4 = std::move(cover3);
+  EXPECT_EQ( n0, mgr().alloc_stats().alloc_num );
+  EXPECT_EQ( cover2, cover4 );
+  EXPECT_EQ( AlgCover(mgr(), "a + b"), cover3 );
+}
+
+TEST_F(CoverTest, assign1)
+{
+  // 容量の小さいカバーに大きなカバーを代入する．
+  string str;
+  for ( int i = 0; i < 30; ++ i ) {
+    if ( i > 0 ) {
+      str += " + ";
+    }
+    str += mgr().varname(i);
+  }
+  AlgCover cover1(mgr(), str);
+
+  SizeType used0 = mgr().alloc_stats().used_words;
+  {
+    AlgCover cover2(mgr(), "a b");
+    cover2 = cover1;
+    EXPECT_EQ( cover1, cover2 );
+    cover2 = AlgCover(mgr(), "a");
+    EXPECT_EQ( AlgCover(mgr(), "a"), cover2 );
+  }
+  // 古い領域が正しく解放されている．
+  EXPECT_EQ( used0, mgr().alloc_stats().used_words );
+}
+
+TEST_F(CoverTest, no_copy1)
+{
+  AlgCover a(mgr(), "a + b");
+  AlgCover b(mgr(), "c + d");
+  AlgCover c(mgr(), "e f");
+  AlgCover d(mgr(), "a");
+
+  // 途中の結果はすべて最初の a * b の領域上で計算される．
+  SizeType n0 = mgr().alloc_stats().alloc_num;
+  AlgCover ans = (a * b + c) / d;
+  EXPECT_EQ( n0 + 1, mgr().alloc_stats().alloc_num );
+  EXPECT_EQ( AlgCover(mgr(), "c + d"), ans );
+}
+
+TEST_F(CoverTest, vector1)
+{
+  // vector の再割り当てでコピーが起こらないことを確かめる．
+  // 内部の領域に収まらないように変数の数を大きくしておく．
+  AlgMgr mgr2(200);
+  vector<AlgCover> cover_list;
+  SizeType n0 = mgr2.alloc_stats().alloc_num;
+  for ( int i = 0; i < 100; ++ i ) {
+    cover_list.push_back(AlgCover(mgr2, mgr2.varname(i)));
+  }
+  EXPECT_EQ( n0 + 100, mgr2.alloc_stats().alloc_num );
+  for ( int i = 0; i < 100; ++ i ) {
+    EXPECT_EQ( AlgCover(mgr2, mgr2.varname(i)), cover_list[i] );
+  }
+}
+
 TEST_F(CoverTest, print1)
 {
   AlgCover cover(mgr());
@@ -1097,4 +1293,272 @@ TEST(CoverTest2, print4)
   EXPECT_EQ( string("x0 x1' + x0' x2"), tmp.str() );
 }
 
+TEST_F(CoverTest, inline_body)
+{
+  // 30変数で4キューブ以下のカバーは内部の領域に収まるので
+  // new_body() を呼ばない．
+  SizeType alloc_num0 = mgr().alloc_stats().alloc_num;
+  {
+    AlgCover cover1(mgr(), "a b + a c");
+    AlgCover cover2(cover1);
+    AlgCube ccube = cover1.common_cube();
+    AlgCover cover3 = cover1 / ccube;
+    EXPECT_EQ( AlgCover(mgr(), "b + c"), cover3 );
+    AlgCover cover4 = cover3 + AlgCover(mgr(), "d");
+    EXPECT_EQ( AlgCover(mgr(), "b + c + d"), cover4 );
+    AlgCover cover5(std::move(cover4));
+    EXPECT_EQ( AlgCover(mgr(), "b + c + d"), cover5 );
+    cover5.swap(cover2);
+    EXPECT_EQ( AlgCover(mgr(), "a b + a c"), cover5 );
+    EXPECT_EQ( AlgCover(mgr(), "b + c + d"), cover2 );
+  }
+  EXPECT_EQ( alloc_num0, mgr().alloc_stats().alloc_num );
+}
+
+TEST_F(CoverTest, spill_body)
+{
+  // 内部の領域からあふれる場合
+  AlgCover cover1(mgr(), "a + b");
+  AlgCover cover2(mgr(), "c + d + e");
+  cover1 *= cover2;
+  EXPECT_EQ( AlgCover(mgr(), "a c + a d + a e + b c + b d + b e"), cover1 );
+
+  AlgCover cover3(mgr(), "f");
+  cover3 += cover1;
+  EXPECT_EQ( AlgCover(mgr(), "a c + a d + a e + b c + b d + b e + f"), cover3 );
+
+  // 内部の領域を使うものとヒープのものとの入れ替え
+  cover2.swap(cover3);
+  EXPECT_EQ( AlgCover(mgr(), "c + d + e"), cover3 );
+  EXPECT_EQ( AlgCover(mgr(), "a c + a d + a e + b c + b d + b e + f"), cover2 );
+  cover3.swap(cover2);
+  EXPECT_EQ( AlgCover(mgr(), "c + d + e"), cover2 );
+
+  AlgCover cover4(std::move(cover3));
+  EXPECT_EQ( 7, cover4.cube_num() );
+  EXPECT_EQ( 0, cover3.cube_num() );
+  cover3 = cover2;
+  EXPECT_EQ( cover2, cover3 );
+
+  auto qr = cover4.div_rem(AlgCover(mgr(), "c + d"));
+  EXPECT_EQ( AlgCover(mgr(), "a + b"), qr.first );
+  EXPECT_EQ( AlgCover(mgr(), "a e + b e + f"), qr.second );
+}
+
+TEST_F(CoverTest, self_sum_inline)
+{
+  // 自分自身との和で内部の領域からあふれる場合
+  AlgCover cover(mgr(), "a + b + c");
+  cover += cover;
+  EXPECT_EQ( 3, cover.cube_num() );
+  EXPECT_EQ( AlgCover(mgr(), "a + b + c"), cover );
+}
+
+TEST_F(CoverTest, self_sum_heap)
+{
+  // 自分自身との和でヒープの領域を拡張する場合
+  const char* str = "a + b + c + d + e + f + g + h + i + j";
+  AlgCover cover(mgr(), str);
+  cover += cover;
+  EXPECT_EQ( 10, cover.cube_num() );
+  EXPECT_EQ( AlgCover(mgr(), str), cover );
+}
+
+TEST_F(CoverTest, make_scc_minimal1)
+{
+  AlgCover cover(mgr(), "a + a b + a c + b c + b c d + d e");
+  cover.make_scc_minimal();
+  EXPECT_EQ( AlgCover(mgr(), "a + b c + d e"), cover );
+
+  // 極小なものは変わらない．
+  AlgCover cover2(mgr(), "a b + b c + a' c'");
+  AlgCover cover3(cover2);
+  cover3.make_scc_minimal();
+  EXPECT_EQ( cover2, cover3 );
+}
+
+TEST(CoverTest2, make_scc_minimal2)
+{
+  // 複数ワードのキューブの場合
+  AlgMgr mgr(100);
+  AlgLiteral x0(0, false);
+  AlgLiteral x40(40, false);
+  AlgLiteral x70(70, true);
+  AlgLiteral x99(99, false);
+  AlgCover cover(mgr, vector<AlgLiteral>{x0, x40, AlgLiteralUndef,
+					 x0, x40, x70, AlgLiteralUndef,
+					 x70, x99, AlgLiteralUndef,
+					 x0, x70, x99, AlgLiteralUndef,
+					 x40, x99});
+  cover.make_scc_minimal();
+  EXPECT_EQ( AlgCover(mgr, vector<AlgLiteral>{x0, x40, AlgLiteralUndef,
+					      x70, x99, AlgLiteralUndef,
+					      x40, x99}), cover );
+}
+
+TEST(CoverTest2, auto_scc)
+{
+  AlgMgr mgr(10);
+  AlgCover cover1(mgr, "a + b");
+  AlgCover cover2(mgr, "a + c");
+
+  // デフォルトでは極小化しない．
+  EXPECT_FALSE( mgr.auto_scc() );
+  EXPECT_EQ( AlgCover(mgr, "a + a c + a b + b c"), cover1 * cover2 );
+
+  mgr.set_auto_scc(true);
+  EXPECT_EQ( AlgCover(mgr, "a + b c"), cover1 * cover2 );
+  EXPECT_EQ( AlgCover(mgr, "a + b"), cover1 + AlgCube(mgr, "a b") );
+  AlgCover cover3(cover1);
+  cover3 *= cover2;
+  EXPECT_EQ( AlgCover(mgr, "a + b c"), cover3 );
+  cover3 += AlgCover(mgr, "b");
+  EXPECT_EQ( AlgCover(mgr, "a + b"), cover3 );
+  mgr.set_auto_scc(false);
+}
+
+TEST(CoverTest2, signature)
+{
+  // 内容を変更する演算の後もシグネチャが正しいことを確かめる．
+  AlgMgr mgr(100);
+  auto check = [](const AlgCover& cover) {
+    EXPECT_TRUE( cover.has_signature() );
+    AlgCover tmp{cover};
+    tmp.disable_signature();
+    EXPECT_FALSE( tmp.has_signature() );
+    for ( SizeType i = 0; i < cover.cube_num(); ++ i ) {
+      EXPECT_EQ( tmp.signature(i), cover.signature(i) );
+    }
+  };
+
+  AlgCover f{mgr, "a b + a c + d b + d c + e + a b f"};
+  AlgCover g{mgr, "a + d"};
+  AlgCover h{mgr, "b + c"};
+  AlgCube c{mgr, "a"};
+  AlgLiteral x70(70, false);
+  // 変数 70 は変数 6 と同じビットに畳み込まれる．
+  AlgLiteral x6(6, false);
+
+  AlgCover f1{f};
+  f1.enable_signature();
+  check(f1);
+
+  // 演算結果に引き継がれる．
+  auto q = f1 / g;
+  check(q);
+  EXPECT_EQ( f / g, q );
+  auto qr = f1.div_rem(g);
+  check(qr.first);
+  check(qr.second);
+  EXPECT_EQ( f.div_rem(g), qr );
+  auto p = f1 * x70;
+  check(p);
+  EXPECT_EQ( f * x70, p );
+  EXPECT_EQ( f / c, f1 / c );
+  check(f1 / c);
+  check(f1 + h);
+  check(f1 - h);
+
+  // 代入演算子
+  f1 += AlgCover{mgr, vector<AlgLiteral>{x6, x70}};
+  check(f1);
+  f1 *= h;
+  check(f1);
+  f1 /= h;
+  check(f1);
+  f1 /= x70;
+  check(f1);
+  f1 -= AlgCover{mgr, "e"};
+  check(f1);
+  f1.make_scc_minimal();
+  check(f1);
+
+  // コピー，ムーブ，入れ替え
+  AlgCover f2{f1};
+  check(f2);
+  AlgCover f3{std::move(f2)};
+  check(f3);
+  EXPECT_FALSE( f2.has_signature() );
+  AlgCover f4{mgr};
+  f4 = f3;
+  check(f4);
+  AlgCover f5{g};
+  EXPECT_FALSE( f5.has_signature() );
+  f5.swap(f4);
+  check(f5);
+  EXPECT_FALSE( f4.has_signature() );
+
+  // シグネチャを持たないカバーとの演算結果も等しい．
+  mgr.set_auto_scc(true);
+  AlgCover g1{g};
+  g1.enable_signature();
+  auto gh = g1 * h + AlgCover(mgr, "a b c");
+  check(gh);
+  EXPECT_EQ( g * h + AlgCover(mgr, "a b c"), gh );
+  mgr.set_auto_scc(false);
+}
+
+TEST(CoverTest2, product_literal_dup)
+{
+  // 既に含まれているリテラルを掛けると重複したキューブができる．
+  AlgMgr mgr(10);
+  AlgLiteral a(0, false);
+  AlgCover cover1(mgr, "a b + b");
+  AlgCover ans = cover1 * a;
+  EXPECT_EQ( 1, ans.cube_num() );
+  EXPECT_EQ( AlgCover(mgr, "a b"), ans );
+  cover1 *= a;
+  EXPECT_EQ( AlgCover(mgr, "a b"), cover1 );
+
+  // 順序が変わる場合
+  AlgCover cover2(mgr, "a c + c + b");
+  EXPECT_EQ( AlgCover(mgr, "a c + a b"), cover2 * a );
+}
+
+TEST(CoverTest2, self_product)
+{
+  // 自分自身との積
+  AlgMgr mgr(100);
+  for ( bool cache: {false, true} ) {
+    if ( cache ) {
+      mgr.enable_op_cache();
+    }
+    AlgCover e(mgr, "a + b");
+    e *= e;
+    EXPECT_EQ( AlgCover(mgr, "a + a b + b"), e );
+
+    AlgLiteral x70(70, false);
+    AlgCover f(mgr, vector<AlgLiteral>{x70, AlgLiteralUndef,
+				       AlgLiteral(1, false), AlgLiteralUndef,
+				       AlgLiteral(2, true)});
+    AlgCover g{f};
+    AlgCover ref = f * g;
+    f *= f;
+    EXPECT_EQ( ref, f );
+  }
+}
+
+TEST(CoverTest2, self_product_realloc)
+{
+  // 自分自身との積で領域の再確保が起こる場合
+  // (1ワードのキューブ 4 個は内部の領域に収まるが，積の 16 個は収まらない)
+  AlgMgr mgr(30);
+  for ( bool cache: {false, true} ) {
+    if ( cache ) {
+      mgr.enable_op_cache();
+    }
+    AlgCover e(mgr, "a + b + c + d");
+    e *= e;
+    EXPECT_EQ( AlgCover(mgr, "a + a b + a c + a d + b + b c + b d + c + c d + d"), e );
+
+    AlgCover f(mgr, "a b + c + d e + f + g h");
+    AlgCover g{f};
+    AlgCover ref = f * g;
+    f *= f;
+    EXPECT_EQ( ref, f );
+  }
+}
+
 END_NAMESPACE_YM_BFO
+
+
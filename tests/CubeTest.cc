@@ -580,6 +580,29 @@ TEST_F(CubeTest, print1)
   EXPECT_EQ( string(), tmp.str() );
 }
 
+TEST_F(CubeTest, move1)
+{
+  AlgCube cube1(mgr(), "a b c'");
+  AlgCube cube2(cube1);
+
+  SizeType n0 = mgr().alloc_stats().alloc_num;
+  AlgCube cube3(std::move(cube1));
+  EXPECT_EQ( n0, mgr().alloc_stats().alloc_num );
+  EXPECT_EQ( cube2, cube3 );
+
+  // ムーブ元には代入できる．
+  cube1 = cube2;
+  EXPECT_EQ( cube2, cube1 );
+
+  // 右辺値との積は右辺値の領域を使う．
+  // 20変数のキューブは内部の領域に収まるので確保は起こらない．
+  AlgCube cube4(mgr(), "d");
+  n0 = mgr().alloc_stats().alloc_num;
+  AlgCube cube5 = AlgCube(mgr(), "a") * cube4 * cube4;
+  EXPECT_EQ( n0, mgr().alloc_stats().alloc_num );
+  EXPECT_EQ( AlgCube(mgr(), "a d"), cube5 );
+}
+
 TEST_F(CubeTest, print2)
 {
   vector<AlgLiteral> lit_list;
@@ -640,4 +663,44 @@ TEST(CubeTest3, print4)
   EXPECT_EQ( string("x30 x60'"), tmp.str() );
 }
 
+TEST_F(CubeTest, inline_body)
+{
+  // 20変数のキューブは内部の領域に収まるので new_body() を呼ばない．
+  SizeType alloc_num0 = mgr().alloc_stats().alloc_num;
+  {
+    AlgCube cube1(mgr(), "a b' c");
+    AlgCube cube2(cube1);
+    AlgCube cube3(std::move(cube1));
+    cube2 *= AlgCube(mgr(), "d");
+    EXPECT_EQ( AlgCube(mgr(), "a b' c"), cube3 );
+    EXPECT_EQ( AlgCube(mgr(), "a b' c d"), cube2 );
+    cube2.swap(cube3);
+    EXPECT_EQ( AlgCube(mgr(), "a b' c"), cube2 );
+    EXPECT_EQ( AlgCube(mgr(), "a b' c d"), cube3 );
+  }
+  EXPECT_EQ( alloc_num0, mgr().alloc_stats().alloc_num );
+}
+
+TEST_F(CubeTest2, heap_body)
+{
+  // 100変数のキューブは new_body() で確保する．
+  // 内部の領域を使うキューブとの入れ替えも確かめる．
+  AlgMgr mgr2(10);
+  AlgCube cube1(mgr(), vector<AlgLiteral>{AlgLiteral(90, false)});
+  AlgCube cube2(mgr2, vector<AlgLiteral>{AlgLiteral(3, true)});
+  SizeType alloc_num0 = mgr().alloc_stats().alloc_num;
+  AlgCube cube3(cube1);
+  EXPECT_EQ( alloc_num0 + 1, mgr().alloc_stats().alloc_num );
+
+  cube1.swap(cube2);
+  EXPECT_EQ( &mgr2, &cube1.mgr() );
+  EXPECT_EQ( AlgCube(mgr2, vector<AlgLiteral>{AlgLiteral(3, true)}), cube1 );
+  EXPECT_EQ( cube3, cube2 );
+
+  AlgCube cube4(std::move(cube2));
+  EXPECT_EQ( cube3, cube4 );
+  cube2 = cube1;
+  EXPECT_EQ( cube1, cube2 );
+}
+
 END_NAMESPACE_YM_BFO
@@ -0,0 +1,69 @@
+
+/// @file ExprTest.cc
+/// @brief AlgExpr のテストプログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "gtest/gtest.h"
+#include "ym/AlgExpr.h"
+#include "ym/AlgCover.h"
+#include "ym/AlgMgr.h"
+#include <sstream>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+TEST(ExprTest, constant)
+{
+  AlgMgr mgr(4);
+  AlgExpr zero;
+  AlgExpr one = AlgExpr::one();
+  EXPECT_TRUE( zero.is_zero() );
+  EXPECT_TRUE( one.is_one() );
+  EXPECT_EQ( 0, zero.literal_num() );
+  EXPECT_EQ( AlgCover(mgr), zero.to_cover(mgr) );
+  EXPECT_EQ( AlgCover(mgr, 0), one.to_cover(mgr) );
+
+  AlgExpr a = AlgExpr::literal(AlgLiteral(0, false));
+  EXPECT_EQ( a, a & one );
+  EXPECT_EQ( zero, a & zero );
+  EXPECT_EQ( a, a | zero );
+  EXPECT_EQ( one, a | one );
+  EXPECT_EQ( one, AlgExpr::and_op({}) );
+  EXPECT_EQ( zero, AlgExpr::or_op({}) );
+}
+
+TEST(ExprTest, op)
+{
+  AlgMgr mgr(vector<string>{"a", "b", "c", "d"});
+  AlgExpr a = AlgExpr::literal(AlgLiteral(0, false));
+  AlgExpr b = AlgExpr::literal(AlgLiteral(1, true));
+  AlgExpr c = AlgExpr::literal(AlgLiteral(2, false));
+  AlgExpr d = AlgExpr::literal(AlgLiteral(3, false));
+
+  EXPECT_TRUE( a.is_literal() );
+  EXPECT_EQ( AlgLiteral(1, true), b.literal() );
+
+  // 同じ種類の子供は平坦化される．
+  AlgExpr expr1 = (a | b) | c;
+  EXPECT_TRUE( expr1.is_or() );
+  EXPECT_EQ( 3, expr1.operand_list().size() );
+  EXPECT_EQ( 3, expr1.literal_num() );
+
+  AlgExpr expr2 = (expr1 & d) | (a & c);
+  EXPECT_EQ( 6, expr2.literal_num() );
+  EXPECT_EQ( AlgCover(mgr, "a d + b' d + c d + a c"), expr2.to_cover(mgr) );
+
+  std::ostringstream buf;
+  expr2.print(buf, mgr);
+  EXPECT_EQ( "(a + b' + c) d + a c", buf.str() );
+
+  std::ostringstream buf2;
+  buf2 << expr2;
+  EXPECT_EQ( "(v_0 + v_1' + v_2) v_3 + v_0 v_2", buf2.str() );
+}
+
+END_NAMESPACE_YM_BFO
@@ -0,0 +1,223 @@
+
+/// @file FactorGenTest.cc
+/// @brief AlgFactorGen のテストプログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "gtest/gtest.h"
+#include "ym/AlgFactorGen.h"
+#include "ym/AlgMgr.h"
+#include "ym/AlgPlaReader.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+TEST(FactorGenTest, simple)
+{
+  AlgMgr mgr(vector<string>{"a", "b", "c", "d", "e"});
+  AlgCover cover(mgr, "a c + a d + b c + b d + e");
+
+  for ( auto mode: {kAlgFactorQuick, kAlgFactorGood} ) {
+    AlgFactorGen fg{mode};
+    auto expr = fg.factor(cover);
+    EXPECT_EQ( 5, expr.literal_num() );
+    EXPECT_EQ( cover, expr.to_cover(mgr) );
+  }
+
+  // リテラルでしか括りださないので (a + b) は見つからない．
+  AlgFactorGen fg{kAlgFactorLiteral};
+  auto expr = fg.factor(cover);
+  EXPECT_EQ( 7, expr.literal_num() );
+  EXPECT_EQ( cover, expr.to_cover(mgr) );
+}
+
+TEST(FactorGenTest, trivial)
+{
+  AlgMgr mgr(vector<string>{"a", "b", "c"});
+  AlgFactorGen fg;
+
+  EXPECT_TRUE( fg.factor(AlgCover(mgr)).is_zero() );
+  EXPECT_TRUE( fg.factor(AlgCover(mgr, 0)).is_one() );
+  auto expr1 = fg.factor(AlgCover(mgr, "a b' c"));
+  EXPECT_TRUE( expr1.is_and() );
+  EXPECT_EQ( 3, expr1.literal_num() );
+  // 2回以上現れるリテラルがない．
+  auto expr2 = fg.factor(AlgCover(mgr, "a + b' + c"));
+  EXPECT_TRUE( expr2.is_or() );
+  EXPECT_EQ( 3, expr2.literal_num() );
+}
+
+TEST(FactorGenTest, memo)
+{
+  AlgMgr mgr(vector<string>{"a", "b", "c", "d", "e", "f"});
+  AlgCover cover(mgr, "a c + a d + b c + b d + a e f + b e f");
+
+  AlgFactorGen fg;
+  auto expr = fg.factor(cover);
+  EXPECT_EQ( 6, expr.literal_num() );
+  EXPECT_EQ( cover, expr.to_cover(mgr) );
+  SizeType n = fg.memo_size();
+  EXPECT_LT( 0, n );
+
+  // 2度目は記憶していた結果を返す．
+  EXPECT_EQ( expr, fg.factor(cover) );
+  EXPECT_EQ( n, fg.memo_size() );
+
+  fg.set_mode(kAlgFactorGood);
+  EXPECT_EQ( 0, fg.memo_size() );
+  fg.clear();
+}
+
+TEST(FactorGenTest, random)
+{
+  SizeType nv = 12;
+  AlgMgr mgr(nv);
+  std::mt19937 rg;
+  std::uniform_int_distribution<int> rd(0, 5);
+  for ( SizeType n = 0; n < 20; ++ n ) {
+    vector<AlgCube> cube_list;
+    for ( SizeType i = 0; i < 12; ++ i ) {
+      vector<AlgLiteral> lit_list;
+      for ( SizeType var = 0; var < nv; ++ var ) {
+	int r = rd(rg);
+	if ( r == 0 ) {
+	  lit_list.push_back(AlgLiteral(var, false));
+	}
+	else if ( r == 1 ) {
+	  lit_list.push_back(AlgLiteral(var, true));
+	}
+      }
+      cube_list.push_back(AlgCube(mgr, lit_list));
+    }
+    AlgCover cover(mgr, cube_list);
+    // 吸収されるキューブがあると展開した結果が変わってしまう．
+    cover.make_scc_minimal();
+
+    SizeType lit_num[3];
+    for ( auto mode: {kAlgFactorQuick, kAlgFactorGood, kAlgFactorLiteral} ) {
+      AlgFactorGen fg{mode};
+      auto expr = fg.factor(cover);
+      EXPECT_EQ( cover, expr.to_cover(mgr) );
+      EXPECT_GE( cover.literal_num(), expr.literal_num() );
+      lit_num[mode] = expr.literal_num();
+    }
+    EXPECT_GE( lit_num[kAlgFactorQuick], lit_num[kAlgFactorGood] );
+  }
+}
+
+TEST(FactorGenTest, signature_stats)
+{
+  // 除算と SCC 極小化でシグネチャがどれだけ比較を省いたかを調べる．
+  SizeType nv = 40;
+  AlgMgr mgr(nv);
+  std::mt19937 rg;
+  std::uniform_int_distribution<int> rd(0, 9);
+  vector<AlgCube> cube_list;
+  for ( SizeType i = 0; i < 200; ++ i ) {
+    vector<AlgLiteral> lit_list;
+    for ( SizeType var = 0; var < nv; ++ var ) {
+      int r = rd(rg);
+      if ( r == 0 ) {
+	lit_list.push_back(AlgLiteral(var, false));
+      }
+      else if ( r == 1 ) {
+	lit_list.push_back(AlgLiteral(var, true));
+      }
+    }
+    cube_list.push_back(AlgCube(mgr, lit_list));
+  }
+  AlgCover cover(mgr, cube_list);
+  mgr.clear_signature_stats();
+  auto stats0 = mgr.signature_stats();
+  EXPECT_EQ( 0, stats0.check_num );
+  EXPECT_EQ( 0, stats0.reject_num );
+
+  cover.make_scc_minimal();
+  auto stats1 = mgr.signature_stats();
+  EXPECT_LT( 0, stats1.reject_num );
+  EXPECT_LE( stats1.reject_num, stats1.check_num );
+
+  AlgFactorGen fg{kAlgFactorGood};
+  auto expr = fg.factor(cover);
+  EXPECT_EQ( cover, expr.to_cover(mgr) );
+  auto stats2 = mgr.signature_stats();
+  EXPECT_LT( stats1.check_num, stats2.check_num );
+  EXPECT_LE( stats2.reject_num, stats2.check_num );
+
+  RecordProperty("scc_check_num", static_cast<int>(stats1.check_num));
+  RecordProperty("scc_reject_num", static_cast<int>(stats1.reject_num));
+  RecordProperty("check_num", static_cast<int>(stats2.check_num));
+  RecordProperty("reject_num", static_cast<int>(stats2.reject_num));
+  RecordProperty("reject_permil",
+		 static_cast<int>(stats2.reject_num * 1000 / stats2.check_num));
+}
+
+TEST(FactorGenTest, mcnc)
+{
+  // 環境変数 BFO_MCNC_DIR で指定されたディレクトリにある MCNC(LGSynth91)
+  // の PLA ファイルの各出力をモードごとにファクタリングし，
+  // 積和形と因数分解形のリテラル数と実行時間を記録する．
+  const char* dirname = std::getenv("BFO_MCNC_DIR");
+  if ( dirname == nullptr ) {
+    GTEST_SKIP() << "BFO_MCNC_DIR is not set";
+  }
+  vector<std::filesystem::path> file_list;
+  for ( auto& entry: std::filesystem::directory_iterator{dirname} ) {
+    if ( entry.path().extension() == ".pla" ) {
+      file_list.push_back(entry.path());
+    }
+  }
+  std::sort(file_list.begin(), file_list.end());
+  ASSERT_FALSE( file_list.empty() ) << "no .pla files in " << dirname;
+
+  const char* mode_name[] = { "quick", "good", "literal" };
+  SizeType sop_lit_num = 0;
+  SizeType lit_num[3] = { 0, 0, 0 };
+  std::chrono::steady_clock::duration time[3] = { };
+  for ( auto& path: file_list ) {
+    AlgPlaReader reader;
+    if ( !reader.read(path.string()) ) {
+      ADD_FAILURE() << path << ": " << reader.error_message();
+      continue;
+    }
+    auto& mgr = reader.mgr();
+    for ( auto& cover: reader.cover_list() ) {
+      // 吸収されるキューブがあると展開した結果が変わってしまう．
+      cover.make_scc_minimal();
+      sop_lit_num += cover.literal_num();
+    }
+    for ( auto mode: {kAlgFactorQuick, kAlgFactorGood, kAlgFactorLiteral} ) {
+      AlgFactorGen fg{mode};
+      auto t0 = std::chrono::steady_clock::now();
+      for ( auto& cover: reader.cover_list() ) {
+	auto expr = fg.factor(cover);
+	lit_num[mode] += expr.literal_num();
+	EXPECT_EQ( cover, expr.to_cover(mgr) )
+	  << path << ": " << mode_name[mode];
+      }
+      time[mode] += std::chrono::steady_clock::now() - t0;
+    }
+  }
+
+  auto msec = [](auto d) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(d).count();
+  };
+  RecordProperty("file_num", static_cast<int>(file_list.size()));
+  RecordProperty("sop_literal_num", static_cast<int>(sop_lit_num));
+  for ( auto mode: {kAlgFactorQuick, kAlgFactorGood, kAlgFactorLiteral} ) {
+    string name = mode_name[mode];
+    RecordProperty(name + "_literal_num", static_cast<int>(lit_num[mode]));
+    RecordProperty(name + "_msec", static_cast<int>(msec(time[mode])));
+  }
+}
+
+END_NAMESPACE_YM_BFO
+
@@ -0,0 +1,181 @@
+
+/// @file FastExtractTest.cc
+/// @brief FastExtractTest の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "gtest/gtest.h"
+#include "ym/AlgFastExtract.h"
+#include "ym/AlgMgr.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+class FastExtractTest :
+  public ::testing::Test
+{
+public:
+
+  /// @brief コンストラクタ
+  FastExtractTest() : mMgr(10) { }
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief マネージャを返す．
+  AlgMgr&
+  mgr() { return mMgr; }
+
+  /// @brief 総リテラル数を返す．
+  SizeType
+  literal_num(
+    const vector<AlgCover>& cover_list
+  )
+  {
+    SizeType n = 0;
+    for ( auto& cover: cover_list ) {
+      n += cover.literal_num();
+    }
+    return n;
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // マネージャ
+  AlgMgr mMgr;
+
+};
+
+
+TEST_F(FastExtractTest, double_cube)
+{
+  vector<AlgCover> cover_list{
+    AlgCover(mgr(), "a c + a d + b c + b d"),
+    AlgCover(mgr(), "a c e + a d e")
+  };
+
+  AlgFastExtract fx(mgr());
+  auto step_list = fx.extract(cover_list);
+
+  ASSERT_EQ( 1, step_list.size() );
+  auto& step = step_list[0];
+  // どのカバーにも現れない最初の変数は f
+  EXPECT_EQ( 5, step.var_id );
+  EXPECT_EQ( AlgCover(mgr(), "c + d"), step.divisor );
+  EXPECT_FALSE( step.single_cube );
+  EXPECT_EQ( 5, step.saving );
+  EXPECT_EQ( 9, step.literal_num );
+
+  ASSERT_EQ( 3, cover_list.size() );
+  EXPECT_EQ( AlgCover(mgr(), "a f + b f"), cover_list[0] );
+  EXPECT_EQ( AlgCover(mgr(), "a e f"), cover_list[1] );
+  EXPECT_EQ( AlgCover(mgr(), "c + d"), cover_list[2] );
+}
+
+TEST_F(FastExtractTest, single_cube)
+{
+  vector<AlgCover> cover_list{
+    AlgCover(mgr(), "a b c"),
+    AlgCover(mgr(), "a b d"),
+    AlgCover(mgr(), "a b e"),
+    AlgCover(mgr(), "a b g")
+  };
+
+  AlgFastExtract fx(mgr());
+  auto step_list = fx.extract(cover_list);
+
+  ASSERT_EQ( 1, step_list.size() );
+  auto& step = step_list[0];
+  EXPECT_EQ( 5, step.var_id );
+  EXPECT_EQ( AlgCover(mgr(), "a b"), step.divisor );
+  EXPECT_TRUE( step.single_cube );
+  EXPECT_EQ( 2, step.saving );
+  EXPECT_EQ( 10, step.literal_num );
+
+  ASSERT_EQ( 5, cover_list.size() );
+  EXPECT_EQ( AlgCover(mgr(), "c f"), cover_list[0] );
+  EXPECT_EQ( AlgCover(mgr(), "d f"), cover_list[1] );
+  EXPECT_EQ( AlgCover(mgr(), "e f"), cover_list[2] );
+  EXPECT_EQ( AlgCover(mgr(), "f g"), cover_list[3] );
+  EXPECT_EQ( AlgCover(mgr(), "a b"), cover_list[4] );
+}
+
+TEST_F(FastExtractTest, max_step)
+{
+  vector<AlgCover> cover_list{
+    AlgCover(mgr(), "a c + a d + b c + b d")
+  };
+
+  AlgFastExtract fx(mgr());
+  auto step_list = fx.extract(cover_list, 0);
+
+  EXPECT_EQ( 0, step_list.size() );
+  ASSERT_EQ( 1, cover_list.size() );
+  EXPECT_EQ( AlgCover(mgr(), "a c + a d + b c + b d"), cover_list[0] );
+}
+
+TEST_F(FastExtractTest, no_free_var)
+{
+  // 新しいノードに使える変数がない．
+  AlgMgr mgr4(4);
+  vector<AlgCover> cover_list{
+    AlgCover(mgr4, "a c + a d + b c + b d")
+  };
+
+  AlgFastExtract fx(mgr4);
+  auto step_list = fx.extract(cover_list);
+
+  EXPECT_EQ( 0, step_list.size() );
+  EXPECT_EQ( 1, cover_list.size() );
+}
+
+TEST_F(FastExtractTest, random)
+{
+  // 各ステップで正の削減があり，リテラル数の記録が正しいことを確かめる．
+  AlgMgr mgr40(40);
+  vector<AlgCover> cover_list;
+  ymuint64 seed = 98765;
+  for ( SizeType k = 0; k < 6; ++ k ) {
+    vector<AlgLiteral> lit_list;
+    for ( SizeType i = 0; i < 12; ++ i ) {
+      if ( i > 0 ) {
+	lit_list.push_back(AlgLiteralUndef);
+      }
+      for ( int var = 0; var < 12; ++ var ) {
+	seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+	if ( (seed >> 33) % 4 == 0 ) {
+	  lit_list.push_back(AlgLiteral(var, (seed >> 40) % 4 == 0));
+	}
+      }
+    }
+    cover_list.push_back(AlgCover(mgr40, lit_list));
+  }
+  SizeType nc0 = cover_list.size();
+  SizeType lit_num = literal_num(cover_list);
+
+  AlgFastExtract fx(mgr40);
+  auto step_list = fx.extract(cover_list);
+
+  ASSERT_LT( 0, step_list.size() );
+  EXPECT_EQ( nc0 + step_list.size(), cover_list.size() );
+  for ( SizeType k = 0; k < step_list.size(); ++ k ) {
+    auto& step = step_list[k];
+    EXPECT_LT( 0, step.saving );
+    EXPECT_EQ( lit_num - step.saving, step.literal_num );
+    EXPECT_EQ( step.divisor, cover_list[nc0 + k] );
+    lit_num = step.literal_num;
+  }
+  EXPECT_EQ( lit_num, literal_num(cover_list) );
+}
+
+END_NAMESPACE_YM_BFO
@@ -0,0 +1,189 @@
+
+/// @file KernelGenTest.cc
+/// @brief KernelGenTest の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "gtest/gtest.h"
+#include "ym/AlgKernelGen.h"
+#include "ym/AlgMgr.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+class KernelGenTest :
+  public ::testing::Test
+{
+public:
+
+  /// @brief コンストラクタ
+  KernelGenTest() : mMgr(30) { }
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief マネージャを返す．
+  AlgMgr&
+  mgr() { return mMgr; }
+
+  /// @brief 疑似乱数でカバーを作る．
+  AlgCover
+  random_cover(
+    SizeType cube_num,
+    ymuint64 seed
+  )
+  {
+    vector<AlgLiteral> lit_list;
+    for ( SizeType i = 0; i < cube_num; ++ i ) {
+      if ( i > 0 ) {
+	lit_list.push_back(AlgLiteralUndef);
+      }
+      for ( int var = 0; var < 12; ++ var ) {
+	seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+	if ( (seed >> 33) % 3 == 0 ) {
+	  lit_list.push_back(AlgLiteral(var, false));
+	}
+      }
+    }
+    return AlgCover(mgr(), lit_list);
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // マネージャ
+  AlgMgr mMgr;
+
+};
+
+
+TEST_F(KernelGenTest, generate1)
+{
+  AlgCover cover(mgr(), "a d f + a e f + b d f + b e f + c d f + c e f + g");
+
+  AlgKernelGen kg;
+  vector<AlgKernelInfo> kernel_list;
+  kg.generate(cover, kernel_list);
+
+  ASSERT_EQ( 4, kernel_list.size() );
+
+  auto find = [&](const AlgCover& kernel) -> const AlgKernelInfo* {
+    for ( auto& info: kernel_list ) {
+      if ( info.mKernel == kernel ) {
+	return &info;
+      }
+    }
+    return nullptr;
+  };
+
+  auto p1 = find(cover);
+  ASSERT_TRUE( p1 != nullptr );
+  EXPECT_EQ( AlgCover(mgr(), 1), p1->mCoKernel );
+  EXPECT_EQ( 2, p1->mLevel );
+
+  auto p2 = find(AlgCover(mgr(), "a d + a e + b d + b e + c d + c e"));
+  ASSERT_TRUE( p2 != nullptr );
+  EXPECT_EQ( AlgCover(mgr(), "f"), p2->mCoKernel );
+  EXPECT_EQ( 1, p2->mLevel );
+
+  auto p3 = find(AlgCover(mgr(), "a + b + c"));
+  ASSERT_TRUE( p3 != nullptr );
+  EXPECT_EQ( AlgCover(mgr(), "d f + e f"), p3->mCoKernel );
+  EXPECT_EQ( 0, p3->mLevel );
+
+  auto p4 = find(AlgCover(mgr(), "d + e"));
+  ASSERT_TRUE( p4 != nullptr );
+  EXPECT_EQ( AlgCover(mgr(), "a f + b f + c f"), p4->mCoKernel );
+  EXPECT_EQ( 0, p4->mLevel );
+
+  // 結果はカーネルの昇順に並んでいる．
+  for ( SizeType i = 1; i < kernel_list.size(); ++ i ) {
+    EXPECT_TRUE( kernel_list[i - 1].mKernel < kernel_list[i].mKernel );
+  }
+}
+
+TEST_F(KernelGenTest, generate2)
+{
+  // キューブが1つしかなければカーネルはない．
+  AlgCover cover(mgr(), "a b c");
+
+  AlgKernelGen kg;
+  vector<AlgKernelInfo> kernel_list;
+  kg.generate(cover, kernel_list);
+
+  EXPECT_EQ( 0, kernel_list.size() );
+}
+
+TEST_F(KernelGenTest, generate3)
+{
+  // 共通のキューブを持つ場合
+  AlgCover cover(mgr(), "a b c + a b d");
+
+  AlgKernelGen kg;
+  vector<AlgKernelInfo> kernel_list;
+  kg.generate(cover, kernel_list);
+
+  ASSERT_EQ( 1, kernel_list.size() );
+  EXPECT_EQ( AlgCover(mgr(), "c + d"), kernel_list[0].mKernel );
+  EXPECT_EQ( AlgCover(mgr(), "a b"), kernel_list[0].mCoKernel );
+  EXPECT_EQ( 0, kernel_list[0].mLevel );
+}
+
+TEST_F(KernelGenTest, thread1)
+{
+  // スレッド数に依らず同じ結果になることを確かめる．
+  AlgCover cover = random_cover(60, 2022);
+
+  AlgKernelGen kg1;
+  vector<AlgKernelInfo> kernel_list1;
+  kg1.generate(cover, kernel_list1);
+  EXPECT_LT( 0, kernel_list1.size() );
+
+  for ( SizeType thread_num: {2, 4, 8} ) {
+    AlgKernelGen kg(thread_num);
+    for ( int k = 0; k < 3; ++ k ) {
+      vector<AlgKernelInfo> kernel_list;
+      kg.generate(cover, kernel_list);
+      ASSERT_EQ( kernel_list1.size(), kernel_list.size() );
+      for ( SizeType i = 0; i < kernel_list.size(); ++ i ) {
+	EXPECT_EQ( kernel_list1[i].mKernel, kernel_list[i].mKernel );
+	EXPECT_EQ( kernel_list1[i].mCoKernel, kernel_list[i].mCoKernel );
+	EXPECT_EQ( kernel_list1[i].mLevel, kernel_list[i].mLevel );
+      }
+    }
+  }
+}
+
+TEST_F(KernelGenTest, set_thread_num)
+{
+  // 同じオブジェクトでスレッド数を変えながら繰り返し求める．
+  AlgCover cover = random_cover(60, 2022);
+
+  AlgKernelGen kg1;
+  vector<AlgKernelInfo> kernel_list1;
+  kg1.generate(cover, kernel_list1);
+
+  AlgKernelGen kg;
+  for ( SizeType thread_num: {4, 4, 1, 2, 0, 8} ) {
+    kg.set_thread_num(thread_num);
+    EXPECT_EQ( thread_num > 0 ? thread_num : 1, kg.thread_num() );
+    vector<AlgKernelInfo> kernel_list;
+    kg.generate(cover, kernel_list);
+    ASSERT_EQ( kernel_list1.size(), kernel_list.size() );
+    for ( SizeType i = 0; i < kernel_list.size(); ++ i ) {
+      EXPECT_EQ( kernel_list1[i].mKernel, kernel_list[i].mKernel );
+      EXPECT_EQ( kernel_list1[i].mCoKernel, kernel_list[i].mCoKernel );
+    }
+  }
+}
+
+END_NAMESPACE_YM_BFO
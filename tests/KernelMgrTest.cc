@@ -0,0 +1,266 @@
+
+/// @file KernelMgrTest.cc
+/// @brief KernelMgrTest の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "gtest/gtest.h"
+#include "ym/AlgKernelMgr.h"
+#include "ym/AlgKernelGen.h"
+#include "ym/AlgMgr.h"
+#include "ym/AlgPlaReader.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+class KernelMgrTest :
+  public ::testing::Test
+{
+public:
+
+  /// @brief コンストラクタ
+  KernelMgrTest() : mMgr(30) { }
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief マネージャを返す．
+  AlgMgr&
+  mgr() { return mMgr; }
+
+  /// @brief カーネルの番号を返す．
+  ///
+  /// 見つからない時は kernel_num() を返す．
+  SizeType
+  find(
+    const AlgKernelMgr& kmgr,
+    const AlgCover& kernel
+  )
+  {
+    for ( SizeType i = 0; i < kmgr.kernel_num(); ++ i ) {
+      if ( kmgr.kernel(i) == kernel ) {
+	return i;
+      }
+    }
+    return kmgr.kernel_num();
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // マネージャ
+  AlgMgr mMgr;
+
+};
+
+
+TEST_F(KernelMgrTest, find_kernels1)
+{
+  AlgCover cover(mgr(), "a d f + a e f + b d f + b e f + c d f + c e f + g");
+
+  AlgKernelMgr kmgr(mgr());
+  kmgr.find_kernels(cover);
+
+  ASSERT_EQ( 4, kmgr.kernel_num() );
+
+  SizeType pos1 = find(kmgr, cover);
+  ASSERT_LT( pos1, kmgr.kernel_num() );
+  EXPECT_EQ( AlgCover(mgr(), 1), kmgr.cokernel(pos1) );
+
+  SizeType pos2 = find(kmgr, AlgCover(mgr(), "a d + a e + b d + b e + c d + c e"));
+  ASSERT_LT( pos2, kmgr.kernel_num() );
+  EXPECT_EQ( AlgCover(mgr(), "f"), kmgr.cokernel(pos2) );
+
+  SizeType pos3 = find(kmgr, AlgCover(mgr(), "a + b + c"));
+  ASSERT_LT( pos3, kmgr.kernel_num() );
+  EXPECT_EQ( AlgCover(mgr(), "d f + e f"), kmgr.cokernel(pos3) );
+
+  SizeType pos4 = find(kmgr, AlgCover(mgr(), "d + e"));
+  ASSERT_LT( pos4, kmgr.kernel_num() );
+  EXPECT_EQ( AlgCover(mgr(), "a f + b f + c f"), kmgr.cokernel(pos4) );
+}
+
+TEST_F(KernelMgrTest, find_kernels2)
+{
+  // レベル0のカーネルのみを求める．
+  AlgCover cover(mgr(), "a d f + a e f + b d f + b e f + c d f + c e f + g");
+
+  AlgKernelMgr kmgr(mgr());
+  kmgr.find_kernels(cover, true);
+
+  ASSERT_EQ( 2, kmgr.kernel_num() );
+
+  SizeType pos1 = find(kmgr, AlgCover(mgr(), "a + b + c"));
+  ASSERT_LT( pos1, kmgr.kernel_num() );
+  EXPECT_EQ( AlgCover(mgr(), "d f + e f"), kmgr.cokernel(pos1) );
+
+  SizeType pos2 = find(kmgr, AlgCover(mgr(), "d + e"));
+  ASSERT_LT( pos2, kmgr.kernel_num() );
+  EXPECT_EQ( AlgCover(mgr(), "a f + b f + c f"), kmgr.cokernel(pos2) );
+}
+
+TEST_F(KernelMgrTest, find_kernels3)
+{
+  // 続けて呼んだ時に前の結果が残らないことを確かめる．
+  AlgKernelMgr kmgr(mgr());
+  kmgr.find_kernels(AlgCover(mgr(), "a c + a d + b c + b d"));
+  EXPECT_EQ( 3, kmgr.kernel_num() );
+
+  kmgr.find_kernels(AlgCover(mgr(), "a b c"));
+  EXPECT_EQ( 0, kmgr.kernel_num() );
+}
+
+TEST_F(KernelMgrTest, find_kernels4)
+{
+  // AlgKernelGen と同じ結果になることを確かめる．
+  vector<AlgLiteral> lit_list;
+  ymuint64 seed = 12345;
+  for ( SizeType i = 0; i < 50; ++ i ) {
+    if ( i > 0 ) {
+      lit_list.push_back(AlgLiteralUndef);
+    }
+    for ( int var = 0; var < 10; ++ var ) {
+      seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+      if ( (seed >> 33) % 3 == 0 ) {
+	lit_list.push_back(AlgLiteral(var, (seed >> 40) % 4 == 0));
+      }
+    }
+  }
+  AlgCover cover(mgr(), lit_list);
+
+  AlgKernelMgr kmgr(mgr());
+  kmgr.find_kernels(cover);
+
+  AlgKernelGen kgen;
+  vector<AlgKernelInfo> kernel_list;
+  kgen.generate(cover, kernel_list);
+
+  ASSERT_EQ( kernel_list.size(), kmgr.kernel_num() );
+  for ( auto& info: kernel_list ) {
+    SizeType pos = find(kmgr, info.mKernel);
+    ASSERT_LT( pos, kmgr.kernel_num() );
+    EXPECT_EQ( info.mCoKernel, kmgr.cokernel(pos) );
+  }
+
+  // レベル0のカーネルも一致することを確かめる．
+  AlgKernelMgr kmgr0(mgr());
+  kmgr0.find_kernels(cover, true);
+  SizeType n0 = 0;
+  for ( auto& info: kernel_list ) {
+    if ( info.mLevel == 0 ) {
+      ++ n0;
+      SizeType pos = find(kmgr0, info.mKernel);
+      ASSERT_LT( pos, kmgr0.kernel_num() );
+      EXPECT_EQ( info.mCoKernel, kmgr0.cokernel(pos) );
+    }
+  }
+  EXPECT_EQ( n0, kmgr0.kernel_num() );
+}
+
+TEST(KernelMgrTest2, alloc_count)
+{
+  // 20変数40キューブのカバーのカーネルを求める間の new_body() の回数を記録する．
+  // 同じカバーを100変数(1キューブ4ワード)のマネージャで作ると
+  // キューブもカバーも内部の領域に収まらないので，その回数と比べる．
+  vector<AlgLiteral> lit_list;
+  ymuint64 seed = 12345;
+  for ( SizeType i = 0; i < 40; ++ i ) {
+    if ( i > 0 ) {
+      lit_list.push_back(AlgLiteralUndef);
+    }
+    for ( int var = 0; var < 20; ++ var ) {
+      seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+      if ( (seed >> 33) % 4 == 0 ) {
+	lit_list.push_back(AlgLiteral(var, (seed >> 40) % 4 == 0));
+      }
+    }
+  }
+  auto count = [&](SizeType variable_num, SizeType& kernel_num) {
+    AlgMgr mgr(variable_num);
+    AlgCover cover(mgr, lit_list);
+    AlgKernelMgr kmgr(mgr);
+    SizeType alloc_num0 = mgr.alloc_stats().alloc_num;
+    kmgr.find_kernels(cover);
+    kernel_num = kmgr.kernel_num();
+    return mgr.alloc_stats().alloc_num - alloc_num0;
+  };
+  SizeType kernel_num;
+  SizeType alloc_num = count(20, kernel_num);
+  SizeType wide_kernel_num;
+  SizeType wide_alloc_num = count(100, wide_kernel_num);
+  EXPECT_EQ( 153, kernel_num );
+  EXPECT_EQ( kernel_num, wide_kernel_num );
+  // 内部の領域を使う前は 1451 回だった．
+  EXPECT_LE( alloc_num, 500 );
+  EXPECT_LT( alloc_num * 2, wide_alloc_num );
+
+  RecordProperty("kernel_num", static_cast<int>(kernel_num));
+  RecordProperty("alloc_num", static_cast<int>(alloc_num));
+  RecordProperty("wide_alloc_num", static_cast<int>(wide_alloc_num));
+}
+
+TEST(KernelMgrTest2, mcnc)
+{
+  // 環境変数 BFO_MCNC_DIR で指定されたディレクトリにある MCNC(LGSynth91)
+  // の PLA ファイルを読み込み，各出力のカーネルを求める時間を測る．
+  const char* dirname = std::getenv("BFO_MCNC_DIR");
+  if ( dirname == nullptr ) {
+    GTEST_SKIP() << "BFO_MCNC_DIR is not set";
+  }
+  vector<std::filesystem::path> file_list;
+  for ( auto& entry: std::filesystem::directory_iterator{dirname} ) {
+    if ( entry.path().extension() == ".pla" ) {
+      file_list.push_back(entry.path());
+    }
+  }
+  std::sort(file_list.begin(), file_list.end());
+  ASSERT_FALSE( file_list.empty() ) << "no .pla files in " << dirname;
+
+  auto msec = [](auto d) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(d).count();
+  };
+
+  SizeType total_output_num = 0;
+  SizeType total_kernel_num = 0;
+  std::chrono::steady_clock::duration total_time{0};
+  for ( auto& path: file_list ) {
+    AlgPlaReader reader;
+    if ( !reader.read(path.string()) ) {
+      ADD_FAILURE() << path << ": " << reader.error_message();
+      continue;
+    }
+    AlgKernelMgr kmgr(reader.mgr());
+    SizeType kernel_num = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for ( auto& cover: reader.cover_list() ) {
+      kmgr.find_kernels(cover);
+      kernel_num += kmgr.kernel_num();
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    total_output_num += reader.output_num();
+    total_kernel_num += kernel_num;
+    total_time += t1 - t0;
+    RecordProperty(path.stem().string() + "_msec",
+		   static_cast<int>(msec(t1 - t0)));
+  }
+
+  RecordProperty("file_num", static_cast<int>(file_list.size()));
+  RecordProperty("output_num", static_cast<int>(total_output_num));
+  RecordProperty("kernel_num", static_cast<int>(total_kernel_num));
+  RecordProperty("msec", static_cast<int>(msec(total_time)));
+}
+
+END_NAMESPACE_YM_BFO
@@ -11,6 +11,10 @@
 #include "ym/AlgMgr.h"
 #include "ym/AlgCube.h"
 #include "ym/AlgCover.h"
+#include "AlgLitCount.h"
+#include "AlgCubeOps.h"
+#include <chrono>
+#include <random>
 
 
 BEGIN_NAMESPACE_YM_BFO
@@ -129,6 +133,134 @@ TEST(MgrTest, new_delete4)
   }
 }
 
+TEST(MgrTest, alloc_stats1)
+{
+  ymuint variable_num = 100;
+
+  AlgMgr mgr(variable_num);
+
+  AlgAllocStats stats0 = mgr.alloc_stats();
+
+  ymuint n = 1000;
+  vector<ymuint64*> body_list(n);
+  for (ymuint i = 0; i < n; ++ i) {
+    body_list[i] = mgr.new_body(3);
+  }
+  AlgAllocStats stats1 = mgr.alloc_stats();
+  EXPECT_EQ( stats0.alloc_num + n, stats1.alloc_num );
+  // 3 キューブは 4 キューブのサイズクラスになる．
+  EXPECT_EQ( stats0.used_words + n * 4 * 4, stats1.used_words );
+
+  for (ymuint i = 0; i < n; ++ i) {
+    mgr.delete_body(body_list[i], 3);
+  }
+  AlgAllocStats stats2 = mgr.alloc_stats();
+  EXPECT_EQ( stats0.free_num + n, stats2.free_num );
+  EXPECT_EQ( stats0.used_words, stats2.used_words );
+
+  // 同じサイズクラスの領域は再利用される．
+  for (ymuint i = 0; i < n; ++ i) {
+    body_list[i] = mgr.new_body(4);
+    // 再利用された領域も 0 に初期化されている．
+    for (ymuint j = 0; j < 4 * 4; ++ j) {
+      EXPECT_EQ( 0ULL, body_list[i][j] );
+    }
+  }
+  AlgAllocStats stats3 = mgr.alloc_stats();
+  EXPECT_EQ( stats2.chunk_num, stats3.chunk_num );
+  EXPECT_EQ( stats2.reuse_num + n, stats3.reuse_num );
+  EXPECT_EQ( stats1.used_words, stats3.used_words );
+  EXPECT_EQ( stats1.used_words, stats3.peak_words );
+  for (ymuint i = 0; i < n; ++ i) {
+    mgr.delete_body(body_list[i], 4);
+  }
+}
+
+TEST(MgrTest, workspace1)
+{
+  AlgMgr mgr(10);
+
+  AlgCover cover1(mgr, "a b + a c + b d + c e' + d f");
+  AlgCover cover2(mgr, "a + d");
+
+  // 1回目で作業領域が確保される．
+  {
+    AlgCover cover3 = cover1 + cover2;
+    AlgCover cover4 = cover1 * cover2;
+    AlgCover cover5 = cover1 / cover2;
+  }
+  AlgWorkspaceStats stats1 = mgr.workspace_stats();
+  AlgAllocStats astats1 = mgr.alloc_stats();
+  EXPECT_LT( 0, stats1.max_depth );
+  EXPECT_LT( 0, stats1.peak_words );
+
+  // 2回目以降は作業領域の確保は起こらない．
+  for ( int i = 0; i < 100; ++ i ) {
+    AlgCover cover3 = cover1 + cover2;
+    cover3 += cover1;
+    AlgCover cover4 = cover1 * cover2;
+    cover4 *= cover2;
+    AlgCover cover5 = cover1 / cover2;
+  }
+  AlgWorkspaceStats stats2 = mgr.workspace_stats();
+  EXPECT_EQ( stats1.alloc_num, stats2.alloc_num );
+  EXPECT_EQ( stats1.reserved_words, stats2.reserved_words );
+
+  // new_body() で確保された領域も残っていない．
+  AlgAllocStats astats2 = mgr.alloc_stats();
+  EXPECT_EQ( astats1.used_words, astats2.used_words );
+}
+
+TEST(MgrTest, sort1)
+{
+  // キューブ数とワード数を変えて整列の各方式を確かめる．
+  for ( ymuint variable_num: {10, 60, 100} ) {
+    AlgMgr mgr(variable_num);
+    SizeType nb = (variable_num + 31) / 32;
+    for ( ymuint nc: {3, 20, 100, 1000, 5000} ) {
+      ymuint64* body = mgr.new_body(nc);
+      // 適当な疑似乱数でキューブを作る．
+      // 重複したキューブも含まれるようにする．
+      ymuint64 seed = 12345 + nc + variable_num;
+      for ( ymuint i = 0; i < nc; ++ i ) {
+	if ( i % 7 == 3 ) {
+	  mgr.cube_copy(body, i, body, i / 2);
+	  continue;
+	}
+	vector<AlgLiteral> lit_list;
+	for ( ymuint var = 0; var < variable_num; ++ var ) {
+	  seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+	  ymuint r = (seed >> 33) % 8;
+	  if ( r == 0 ) {
+	    lit_list.push_back(AlgLiteral(var, false));
+	  }
+	  else if ( r == 1 ) {
+	    lit_list.push_back(AlgLiteral(var, true));
+	  }
+	}
+	mgr.set_literal(body, i, lit_list);
+      }
+
+      // 期待値を作る．
+      vector<vector<ymuint64>> exp_list;
+      for ( ymuint i = 0; i < nc; ++ i ) {
+	exp_list.push_back(vector<ymuint64>(body + i * nb, body + (i + 1) * nb));
+      }
+      std::sort(exp_list.begin(), exp_list.end(), std::greater<vector<ymuint64>>());
+      exp_list.erase(std::unique(exp_list.begin(), exp_list.end()), exp_list.end());
+
+      SizeType n = mgr.sort(nc, body);
+      ASSERT_EQ( exp_list.size(), n );
+      for ( ymuint i = 0; i < n; ++ i ) {
+	for ( ymuint j = 0; j < nb; ++ j ) {
+	  EXPECT_EQ( exp_list[i][j], body[i * nb + j] );
+	}
+      }
+      mgr.delete_body(body, nc);
+    }
+  }
+}
+
 TEST(MgrTest, parse1)
 {
   ymuint variable_num = 100;
@@ -215,4 +347,830 @@ TEST(MgrTest, parse5)
   EXPECT_EQ( AlgLiteral(2, false), lit_list[4] );
 }
 
+TEST(MgrTest, parse6)
+{
+  // ビットベクタに直接書き込む．
+  AlgMgr mgr(vector<string>{"x1", "x2", "y_1", "Z"});
+
+  std::string_view str = "x1 y_1' + Z x2 ";
+  ASSERT_EQ( 2, AlgMgr::parse_cube_num(str) );
+  ymuint64* body = mgr.new_body(2);
+  SizeType err_pos;
+  SizeType n = mgr.parse(str, body, err_pos);
+
+  EXPECT_EQ( 2, n );
+  EXPECT_EQ( str.size(), err_pos );
+  EXPECT_EQ( kAlgPolP, mgr.literal(body, 0, 0) );
+  EXPECT_EQ( kAlgPolX, mgr.literal(body, 0, 1) );
+  EXPECT_EQ( kAlgPolN, mgr.literal(body, 0, 2) );
+  EXPECT_EQ( kAlgPolX, mgr.literal(body, 0, 3) );
+  EXPECT_EQ( kAlgPolX, mgr.literal(body, 1, 0) );
+  EXPECT_EQ( kAlgPolP, mgr.literal(body, 1, 1) );
+  EXPECT_EQ( kAlgPolX, mgr.literal(body, 1, 2) );
+  EXPECT_EQ( kAlgPolP, mgr.literal(body, 1, 3) );
+  mgr.delete_body(body, 2);
+}
+
+TEST(MgrTest, parse_error)
+{
+  // エラー位置を確かめる．
+  AlgMgr mgr(10);
+  ymuint64* body = mgr.new_body(4);
+  SizeType err_pos;
+
+  EXPECT_EQ( 0, mgr.parse("a b + c z", body, err_pos) );
+  EXPECT_EQ( 8, err_pos );
+
+  EXPECT_EQ( 0, mgr.parse("a + + b", body, err_pos) );
+  EXPECT_EQ( 4, err_pos );
+
+  EXPECT_EQ( 0, mgr.parse("a b +  ", body, err_pos) );
+  EXPECT_EQ( 4, err_pos );
+
+  EXPECT_EQ( 0, mgr.parse("a * b", body, err_pos) );
+  EXPECT_EQ( 2, err_pos );
+
+  EXPECT_EQ( 0, mgr.parse("", body, err_pos) );
+  EXPECT_EQ( 0, err_pos );
+  mgr.delete_body(body, 4);
+
+  vector<AlgLiteral> lit_list;
+  EXPECT_EQ( 0, mgr.parse("a b + c z", lit_list) );
+  EXPECT_TRUE( lit_list.empty() );
+}
+
+TEST(MgrTest, varid)
+{
+  AlgMgr mgr(100);
+  for ( SizeType var = 0; var < 100; ++ var ) {
+    EXPECT_EQ( var, mgr.varid(mgr.varname(var)) );
+  }
+  EXPECT_EQ( 100, mgr.varid("zz") );
+  EXPECT_EQ( 100, mgr.varid("") );
+}
+
+TEST(MgrTest, cube_ops1)
+{
+  // ワード数ごとに特殊化された関数(1, 2, 4 ワードとそれ以外)を確かめる．
+  for ( SizeType variable_num: {20, 50, 100, 150} ) {
+    AlgMgr mgr(variable_num);
+    SizeType last = variable_num - 1;
+    ymuint64* bv = mgr.new_body(5);
+    // 0: v0 vlast
+    mgr.set_literal(bv, 0, {AlgLiteral(0, false), AlgLiteral(last, false)});
+    // 1: vlast
+    mgr.set_literal(bv, 1, {AlgLiteral(last, false)});
+    // 2: vlast'
+    mgr.set_literal(bv, 2, {AlgLiteral(last, true)});
+
+    EXPECT_EQ( 0, mgr.cube_compare(bv, 0, bv, 0) );
+    EXPECT_EQ( 1, mgr.cube_compare(bv, 0, bv, 1) );
+    EXPECT_EQ( -1, mgr.cube_compare(bv, 2, bv, 1) );
+
+    EXPECT_TRUE( mgr.cube_check_product(bv, 0, bv, 1) );
+    EXPECT_FALSE( mgr.cube_check_product(bv, 0, bv, 2) );
+    EXPECT_TRUE( mgr.cube_check_containment(bv, 0, bv, 1) );
+    EXPECT_FALSE( mgr.cube_check_containment(bv, 1, bv, 0) );
+    EXPECT_TRUE( mgr.cube_check_intersect(bv, 0, bv, 1) );
+    EXPECT_FALSE( mgr.cube_check_intersect(bv, 1, bv, 2) );
+
+    EXPECT_FALSE( mgr.cube_product(bv, 3, bv, 0, bv, 2) );
+    EXPECT_TRUE( mgr.cube_division(bv, 3, bv, 0, bv, 1) );
+    EXPECT_EQ( kAlgPolP, mgr.literal(bv, 3, 0) );
+    EXPECT_EQ( kAlgPolX, mgr.literal(bv, 3, last) );
+    EXPECT_FALSE( mgr.cube_division(bv, 4, bv, 1, bv, 0) );
+    EXPECT_TRUE( mgr.cube_product(bv, 4, bv, 3, bv, 1) );
+    EXPECT_EQ( 0, mgr.cube_compare(bv, 4, bv, 0) );
+
+    mgr.copy(2, bv, 3, bv, 1);
+    EXPECT_EQ( 0, mgr.cube_compare(bv, 3, bv, 1) );
+    EXPECT_EQ( 0, mgr.cube_compare(bv, 4, bv, 2) );
+    mgr.cube_clear(bv, 4);
+    EXPECT_EQ( 0, mgr.literal_num(1, bv + 4 * mgr.cube_size()) );
+
+    mgr.delete_body(bv, 5);
+  }
+}
+
+TEST(MgrTest, cube_ops_bench)
+{
+  // ワード数ごとに積，除算，整列の時間を測る．
+  // 1, 2, 4 ワードでは特殊化された関数を汎用の関数と比べる．
+  auto usec = [](auto d) {
+    return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(d).count());
+  };
+  for ( SizeType variable_num: {20, 50, 100, 150} ) {
+    AlgMgr mgr(variable_num);
+    SizeType nb = mgr.cube_size();
+    ymuint64 seed = 12345 + variable_num;
+    auto fill = [&](ymuint64* body, SizeType nc) {
+      for ( SizeType i = 0; i < nc; ++ i ) {
+	for ( SizeType var = 0; var < variable_num; ++ var ) {
+	  seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+	  SizeType r = (seed >> 33) % 16;
+	  if ( r == 0 ) {
+	    mgr.set_literal(body, i, var, kAlgPolP);
+	  }
+	  else if ( r == 1 ) {
+	    mgr.set_literal(body, i, var, kAlgPolN);
+	  }
+	}
+      }
+      return mgr.sort(nc, body);
+    };
+    const SizeType nc1 = 2000;
+    const SizeType nc2 = 50;
+    ymuint64* bv1 = mgr.new_body(nc1);
+    ymuint64* bv2 = mgr.new_body(nc2);
+    SizeType n1 = fill(bv1, nc1);
+    SizeType n2 = fill(bv2, nc2);
+    ymuint64* dst = mgr.new_body(nc1 * nc2);
+    ymuint64* rem = mgr.new_body(nc1 * nc2);
+    string suffix = "_" + std::to_string(nb) + "w_usec";
+
+    auto t0 = std::chrono::steady_clock::now();
+    SizeType np = mgr.product(dst, n1, bv1, n2, bv2);
+    auto t1 = std::chrono::steady_clock::now();
+    EXPECT_LT( 0, np );
+    RecordProperty("product" + suffix, usec(t1 - t0));
+
+    SizeType rem_nc;
+    auto t2 = std::chrono::steady_clock::now();
+    SizeType nq = mgr.division(rem, dst, rem_nc, np, dst, n2, bv2);
+    auto t3 = std::chrono::steady_clock::now();
+    EXPECT_EQ( np, nq * n2 + rem_nc );
+    RecordProperty("division" + suffix, usec(t3 - t2));
+
+    // 整列済みでない 100k キューブを整列する．
+    SizeType ns = nc1 * nc2;
+    for ( SizeType i = 0; i < ns; ++ i ) {
+      mgr.cube_clear(dst, i);
+    }
+    for ( SizeType i = 0; i < ns; ++ i ) {
+      for ( SizeType var = 0; var < variable_num; ++ var ) {
+	seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+	SizeType r = (seed >> 33) % 16;
+	if ( r == 0 ) {
+	  mgr.set_literal(dst, i, var, kAlgPolP);
+	}
+      }
+    }
+    auto t4 = std::chrono::steady_clock::now();
+    SizeType ns2 = mgr.sort(ns, dst);
+    auto t5 = std::chrono::steady_clock::now();
+    EXPECT_LE( ns2, ns );
+    RecordProperty("sort" + suffix, usec(t5 - t4));
+
+    if ( nb == 1 || nb == 2 || nb == 4 ) {
+      // キューブ単位の積と比較を全ての組み合わせについて行う．
+      // 1, 2, 4 以外のワード数に対しては汎用の関数の表が返る．
+      auto cube_bench = [&](const AlgCubeOps* ops) {
+	SizeType count = 0;
+	ymuint64 tmp[4];
+	auto t0 = std::chrono::steady_clock::now();
+	for ( SizeType i = 0; i < n1; ++ i ) {
+	  for ( SizeType j = 0; j < n2; ++ j ) {
+	    const ymuint64* c1 = bv1 + i * nb;
+	    const ymuint64* c2 = bv2 + j * nb;
+	    if ( ops->product(tmp, c1, c2, nb) ) {
+	      ++ count;
+	    }
+	    if ( ops->division(tmp, c1, c2, nb) ) {
+	      ++ count;
+	    }
+	    count += ops->compare(c1, c2, nb) + 1;
+	  }
+	}
+	auto t1 = std::chrono::steady_clock::now();
+	return std::make_pair(count, usec(t1 - t0));
+      };
+      auto spec = cube_bench(AlgCubeOps::get(nb));
+      auto generic = cube_bench(AlgCubeOps::get(0));
+      EXPECT_EQ( generic.first, spec.first );
+      string suffix = "_" + std::to_string(nb) + "w_usec";
+      RecordProperty("cube_ops_spec" + suffix, spec.second);
+      RecordProperty("cube_ops_generic" + suffix, generic.second);
+    }
+
+    mgr.delete_body(bv1, nc1);
+    mgr.delete_body(bv2, nc2);
+    mgr.delete_body(dst, nc1 * nc2);
+    mgr.delete_body(rem, nc1 * nc2);
+  }
+}
+
+TEST(MgrTest, literal_num1)
+{
+  // ワード数を変えて SIMD 版の端数処理も含めて確かめる．
+  for ( ymuint variable_num: {10, 100} ) {
+    AlgMgr mgr(variable_num);
+    for ( ymuint nc = 1; nc <= 40; ++ nc ) {
+      vector<AlgLiteral> lit_list;
+      for ( ymuint i = 0; i < nc; ++ i ) {
+	if ( i > 0 ) {
+	  lit_list.push_back(AlgLiteralUndef);
+	}
+	for ( ymuint var = 0; var < variable_num; ++ var ) {
+	  ymuint r = (var * 7 + i * 13 + nc) % 5;
+	  if ( r == 1 ) {
+	    lit_list.push_back(AlgLiteral(var, false));
+	  }
+	  else if ( r == 3 ) {
+	    lit_list.push_back(AlgLiteral(var, true));
+	  }
+	}
+      }
+      ymuint64* body = mgr.new_body(nc);
+      mgr.set_literal(body, 0, lit_list);
+
+      SizeType exp_num = 0;
+      for ( ymuint i = 0; i < nc; ++ i ) {
+	for ( ymuint var = 0; var < variable_num; ++ var ) {
+	  if ( mgr.literal(body, i, var) != kAlgPolX ) {
+	    ++ exp_num;
+	  }
+	}
+      }
+      EXPECT_EQ( exp_num, mgr.literal_num(nc, body) );
+
+      // CPU が実際に選ぶものに限らず，使える実装を全て確かめる．
+      SizeType nw = nc * mgr.cube_size();
+      SizeType scalar_num = lit_count(body, nw, kAlgLitCountScalar);
+      EXPECT_EQ( exp_num, scalar_num );
+      for ( auto impl: {kAlgLitCountPopcnt, kAlgLitCountAvx2, kAlgLitCountAvx512} ) {
+	if ( lit_count_supported(impl) ) {
+	  EXPECT_EQ( scalar_num, lit_count(body, nw, impl) );
+	}
+      }
+      mgr.delete_body(body, nc);
+    }
+  }
+}
+
+TEST(MgrTest, literal_num_bench)
+{
+  // キューブ数ごとに各実装でリテラル数を数える時間を測る．
+  // 比較のために元の 8ビット表引きの実装も測る．
+  auto table_count = [](const ymuint64* bv, SizeType n) {
+    int count[256];
+    for ( int b = 0; b < 256; ++ b ) {
+      int c = 0;
+      for ( int i = 0; i < 8; i += 2 ) {
+	if ( ((b >> i) & 3) != 0 ) {
+	  ++ c;
+	}
+      }
+      count[b] = c;
+    }
+    SizeType ans = 0;
+    for ( SizeType i = 0; i < n; ++ i ) {
+      ymuint64 w = bv[i];
+      for ( int j = 0; j < 64; j += 8 ) {
+	ans += count[(w >> j) & 255];
+      }
+    }
+    return ans;
+  };
+
+  const char* impl_name[] = { "scalar", "popcnt", "avx2", "avx512" };
+  AlgMgr mgr(100);
+  std::mt19937 rg;
+  std::uniform_int_distribution<int> rd(0, 4);
+  for ( SizeType nc: {16, 256, 4096, 65536} ) {
+    ymuint64* body = mgr.new_body(nc);
+    for ( SizeType i = 0; i < nc; ++ i ) {
+      for ( SizeType var = 0; var < 100; ++ var ) {
+	int r = rd(rg);
+	if ( r == 1 ) {
+	  mgr.set_literal(body, i, var, kAlgPolP);
+	}
+	else if ( r == 3 ) {
+	  mgr.set_literal(body, i, var, kAlgPolN);
+	}
+      }
+    }
+    SizeType nw = nc * mgr.cube_size();
+    // どのキューブ数でも合計でほぼ同じワード数を数える．
+    SizeType rep = std::max<SizeType>(1, (1 << 22) / nw);
+    auto nsec = [&](auto func) {
+      SizeType sum = 0;
+      auto t0 = std::chrono::steady_clock::now();
+      for ( SizeType i = 0; i < rep; ++ i ) {
+	sum += func();
+      }
+      auto t1 = std::chrono::steady_clock::now();
+      auto d = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0);
+      EXPECT_EQ( table_count(body, nw) * rep, sum );
+      return static_cast<int>(d.count() / rep);
+    };
+    string suffix = "_" + std::to_string(nc) + "_nsec";
+    RecordProperty("table" + suffix, nsec([&]{ return table_count(body, nw); }));
+    for ( auto impl: {kAlgLitCountScalar, kAlgLitCountPopcnt,
+		      kAlgLitCountAvx2, kAlgLitCountAvx512} ) {
+      if ( lit_count_supported(impl) ) {
+	RecordProperty(impl_name[impl] + suffix,
+		       nsec([&]{ return lit_count(body, nw, impl); }));
+      }
+    }
+    RecordProperty("literal_num" + suffix,
+		   nsec([&]{ return mgr.literal_num(nc, body); }));
+    mgr.delete_body(body, nc);
+  }
+}
+
+TEST(MgrTest, literal_histogram1)
+{
+  // 4の倍数でないキューブ数や，途中で counts に書き出す
+  // 大きなキューブ数も含めて確かめる．
+  for ( ymuint variable_num: {10, 100} ) {
+    AlgMgr mgr(variable_num);
+    for ( ymuint nc: {0, 1, 3, 4, 5, 17, 40, 270001} ) {
+      if ( variable_num > 10 && nc > 1000 ) {
+	continue;
+      }
+      ymuint64* body = mgr.new_body(nc);
+      for ( ymuint i = 0; i < nc; ++ i ) {
+	for ( ymuint var = 0; var < variable_num; ++ var ) {
+	  ymuint r = (var * 7 + i * 13 + nc) % 5;
+	  if ( r == 1 ) {
+	    mgr.set_literal(body, i, var, kAlgPolP);
+	  }
+	  else if ( r == 3 ) {
+	    mgr.set_literal(body, i, var, kAlgPolN);
+	  }
+	}
+      }
+
+      vector<SizeType> counts;
+      mgr.literal_histogram(nc, body, counts);
+      ASSERT_EQ( variable_num * 2, counts.size() );
+      for ( ymuint var = 0; var < variable_num; ++ var ) {
+	for ( bool inv: {false, true} ) {
+	  AlgLiteral lit(var, inv);
+	  EXPECT_EQ( mgr.literal_num(nc, body, lit), counts[lit.index()] );
+	}
+      }
+      mgr.delete_body(body, nc);
+    }
+  }
+}
+
+TEST(MgrTest, hash1)
+{
+  AlgMgr mgr(64);
+  ymuint64* bv = mgr.new_body(4);
+  bv[0] = 0x0123456789ABCDEFULL;
+  bv[1] = 0xFEDCBA9876543210ULL;
+  // 前のキューブの2ワードを入れ替えたもの
+  bv[2] = bv[1];
+  bv[3] = bv[0];
+
+  // 以前の 16 ビットごとの XOR ではこれらは衝突していた．
+  EXPECT_NE( mgr.hash(1, bv), mgr.hash(1, bv + 2) );
+  EXPECT_NE( mgr.hash(2, bv), AlgMgr::kHashInit );
+
+  // キューブ単位で追加しても同じ値になる．
+  SizeType h = AlgMgr::kHashInit;
+  h = mgr.hash_append(h, 1, bv);
+  h = mgr.hash_append(h, 1, bv + 2);
+  EXPECT_EQ( mgr.hash(2, bv), h );
+  EXPECT_EQ( AlgMgr::kHashInit, mgr.hash(0, bv) );
+
+  mgr.delete_body(bv, 4);
+}
+
+TEST(MgrTest, product1)
+{
+  // 1ワードと複数ワードのキューブで，
+  // タイルをまたぐキューブ数も含めて総当たりの結果と比べる．
+  for ( ymuint variable_num: {10, 100} ) {
+    AlgMgr mgr(variable_num);
+    for ( auto nc_pair: vector<pair<ymuint, ymuint>>{{0, 3}, {3, 0}, {1, 1},
+						     {5, 7}, {3, 4100}} ) {
+      ymuint nc1 = nc_pair.first;
+      ymuint nc2 = nc_pair.second;
+      auto make_body = [&](ymuint nc, ymuint seed) {
+	ymuint64* body = mgr.new_body(nc);
+	for ( ymuint i = 0; i < nc; ++ i ) {
+	  for ( ymuint var = 0; var < variable_num; ++ var ) {
+	    ymuint r = (var * 7 + i * 13 + seed) % 11;
+	    if ( r == 1 ) {
+	      mgr.set_literal(body, i, var, kAlgPolP);
+	    }
+	    else if ( r == 3 ) {
+	      mgr.set_literal(body, i, var, kAlgPolN);
+	    }
+	  }
+	}
+	return body;
+      };
+      ymuint64* body1 = make_body(nc1, 1);
+      ymuint64* body2 = make_body(nc2, 5);
+
+      ymuint64* exp_body = mgr.new_body(nc1 * nc2);
+      SizeType exp_nc = 0;
+      for ( ymuint i = 0; i < nc1; ++ i ) {
+	for ( ymuint j = 0; j < nc2; ++ j ) {
+	  if ( mgr.cube_product(exp_body, exp_nc, body1, i, body2, j) ) {
+	    ++ exp_nc;
+	  }
+	}
+      }
+      exp_nc = mgr.sort(exp_nc, exp_body);
+
+      ymuint64* ans_body = mgr.new_body(nc1 * nc2);
+      SizeType ans_nc = mgr.product(ans_body, nc1, body1, nc2, body2);
+      ASSERT_EQ( exp_nc, ans_nc );
+      for ( SizeType i = 0; i < ans_nc; ++ i ) {
+	EXPECT_EQ( 0, mgr.cube_compare(exp_body, i, ans_body, i) );
+      }
+
+      mgr.delete_body(body1, nc1);
+      mgr.delete_body(body2, nc2);
+      mgr.delete_body(exp_body, nc1 * nc2);
+      mgr.delete_body(ans_body, nc1 * nc2);
+    }
+  }
+}
+
+TEST(MgrTest, product2)
+{
+  // 結果は整列されて重複が取り除かれる．
+  AlgMgr mgr(vector<string>{"a", "b", "c"});
+  AlgCover cover1(mgr, "a + b");
+  AlgCover cover2(mgr, "b + a");
+  AlgCover cover3(mgr, "a c' + a' c");
+
+  EXPECT_EQ( AlgCover(mgr, "a + a b + b"), cover1 * cover2 );
+  EXPECT_EQ( 3, (cover1 * cover2).cube_num() );
+  // 相反するリテラルを含む積は現れない．
+  EXPECT_EQ( AlgCover(mgr, "a c'"), AlgCover(mgr, "a") * cover3 );
+}
+
+TEST(MgrTest, division1)
+{
+  // 複数ワードのキューブで剰余を被除数の領域に書き込む場合
+  AlgMgr mgr(100);
+  AlgLiteral x0(0, false);
+  AlgLiteral x1(1, false);
+  AlgLiteral x2n(2, true);
+  AlgLiteral x3(3, false);
+  AlgLiteral x40(40, false);
+  AlgLiteral x50(50, false);
+  AlgLiteral x64(64, false);
+  AlgLiteral x65(65, false);
+  AlgLiteral x70n(70, true);
+  AlgLiteral x98n(98, true);
+  AlgLiteral x99(99, false);
+  vector<vector<AlgLiteral>> d_list{{x0}, {x40, x70n}, {x99}};
+  vector<vector<AlgLiteral>> q_list{{x1, x50}, {x2n}, {x64, x65}};
+  vector<vector<AlgLiteral>> r_list{{x3, x40}, {x98n}};
+
+  auto make_body = [&](const vector<vector<AlgLiteral>>& cube_list) {
+    vector<AlgLiteral> lit_list;
+    for ( auto& cube: cube_list ) {
+      if ( !lit_list.empty() ) {
+	lit_list.push_back(AlgLiteralUndef);
+      }
+      lit_list.insert(lit_list.end(), cube.begin(), cube.end());
+    }
+    ymuint64* body = mgr.new_body(cube_list.size());
+    mgr.set_literal(body, 0, lit_list);
+    SizeType n = mgr.sort(cube_list.size(), body);
+    EXPECT_EQ( cube_list.size(), n );
+    return body;
+  };
+
+  vector<vector<AlgLiteral>> f_list{r_list};
+  for ( auto& q: q_list ) {
+    for ( auto& d: d_list ) {
+      vector<AlgLiteral> cube{q};
+      cube.insert(cube.end(), d.begin(), d.end());
+      f_list.push_back(cube);
+    }
+  }
+  SizeType nf = f_list.size();
+  ymuint64* f_body = make_body(f_list);
+  ymuint64* d_body = make_body(d_list);
+  ymuint64* q_body = make_body(q_list);
+  ymuint64* r_body = make_body(r_list);
+
+  ymuint64* ans_body = mgr.new_body(nf);
+  SizeType rem_nc;
+  SizeType nq = mgr.division(ans_body, f_body, rem_nc, nf, f_body, 3, d_body);
+  EXPECT_EQ( 0, mgr.compare(nq, ans_body, 3, q_body) );
+  EXPECT_EQ( 0, mgr.compare(rem_nc, f_body, 2, r_body) );
+
+  mgr.delete_body(f_body, nf);
+  mgr.delete_body(d_body, 3);
+  mgr.delete_body(q_body, 3);
+  mgr.delete_body(r_body, 2);
+  mgr.delete_body(ans_body, nf);
+}
+
+TEST(MgrTest, division_bench)
+{
+  // 1k〜100k キューブの被除数を4キューブの除数で割る時間を測る．
+  // 比較のために元の O(nc1^2) の実装も(10k キューブまで)測る．
+  AlgMgr mgr(64);
+  SizeType nb = mgr.cube_size();
+  auto old_division = [&](ymuint64* dst_bv,
+			  SizeType nc1, const ymuint64* bv1,
+			  SizeType nc2, const ymuint64* bv2) {
+    vector<ymuint64> tmp(nc1 * nb);
+    vector<bool> mark(nc1, false);
+    for ( SizeType i = 0; i < nc1; ++ i ) {
+      for ( SizeType j = 0; j < nc2; ++ j ) {
+	if ( mgr.cube_division(tmp.data(), i, bv1, i, bv2, j) ) {
+	  mark[i] = true;
+	  break;
+	}
+      }
+    }
+    SizeType nc = 0;
+    for ( SizeType i = 0; i < nc1; ++ i ) {
+      if ( !mark[i] ) {
+	continue;
+      }
+      SizeType c = 1;
+      vector<SizeType> tmp_list;
+      for ( SizeType i2 = i + 1; i2 < nc1; ++ i2 ) {
+	if ( mark[i2] && mgr.cube_compare(tmp.data(), i, tmp.data(), i2) == 0 ) {
+	  ++ c;
+	  tmp_list.push_back(i2);
+	}
+      }
+      if ( c == nc2 ) {
+	mgr.cube_copy(dst_bv, nc, tmp.data(), i);
+	++ nc;
+	for ( auto pos: tmp_list ) {
+	  mark[pos] = false;
+	}
+      }
+    }
+    return mgr.sort(nc, dst_bv);
+  };
+
+  vector<AlgLiteral> d_list{AlgLiteral(0, false), AlgLiteralUndef,
+			    AlgLiteral(1, false), AlgLiteralUndef,
+			    AlgLiteral(2, false), AlgLiteralUndef,
+			    AlgLiteral(3, true)};
+  SizeType nd = 4;
+  ymuint64* d_body = mgr.new_body(nd);
+  mgr.set_literal(d_body, 0, d_list);
+  nd = mgr.sort(nd, d_body);
+
+  std::mt19937 rg;
+  std::uniform_int_distribution<int> rd(0, 9);
+  auto rand_cube = [&]() {
+    vector<AlgLiteral> lit_list;
+    for ( SizeType var = 4; var < 64; ++ var ) {
+      int r = rd(rg);
+      if ( r == 0 ) {
+	lit_list.push_back(AlgLiteral(var, false));
+      }
+      else if ( r == 1 ) {
+	lit_list.push_back(AlgLiteral(var, true));
+      }
+    }
+    return lit_list;
+  };
+  auto usec = [](auto d) {
+    return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(d).count());
+  };
+
+  for ( SizeType n: {1000, 10000, 100000} ) {
+    // 商の候補を n / 5 個，剰余の候補を n / 5 個作る．
+    // 剰余の半分は除数のリテラルを1つ含む．
+    SizeType nq0 = n / 5;
+    ymuint64* q0_body = mgr.new_body(nq0);
+    for ( SizeType i = 0; i < nq0; ++ i ) {
+      mgr.set_literal(q0_body, i, rand_cube());
+    }
+    nq0 = mgr.sort(nq0, q0_body);
+    SizeType nf = nq0 * nd + n / 5;
+    ymuint64* f_body = mgr.new_body(nf);
+    mgr.product(f_body, nq0, q0_body, nd, d_body);
+    for ( SizeType i = nq0 * nd; i < nf; ++ i ) {
+      auto lit_list = rand_cube();
+      if ( i % 2 == 0 ) {
+	lit_list.push_back(AlgLiteral(i % 4, false));
+      }
+      mgr.set_literal(f_body, i, lit_list);
+    }
+    nf = mgr.sort(nf, f_body);
+
+    ymuint64* q_body = mgr.new_body(nf);
+    ymuint64* r_body = mgr.new_body(nf);
+    SizeType rem_nc;
+    auto t0 = std::chrono::steady_clock::now();
+    SizeType nq = mgr.division(q_body, r_body, rem_nc, nf, f_body, nd, d_body);
+    auto t1 = std::chrono::steady_clock::now();
+    EXPECT_LE( nq0, nq );
+    EXPECT_EQ( nf, nq * nd + rem_nc );
+    string suffix = "_" + std::to_string(n) + "_usec";
+    RecordProperty("hash_div_rem" + suffix, usec(t1 - t0));
+
+    auto t2 = std::chrono::steady_clock::now();
+    SizeType nq2 = mgr.division(r_body, nf, f_body, nd, d_body);
+    auto t3 = std::chrono::steady_clock::now();
+    EXPECT_EQ( 0, mgr.compare(nq, q_body, nq2, r_body) );
+    RecordProperty("hash_div" + suffix, usec(t3 - t2));
+
+    if ( n <= 10000 ) {
+      auto t4 = std::chrono::steady_clock::now();
+      SizeType nq3 = old_division(r_body, nf, f_body, nd, d_body);
+      auto t5 = std::chrono::steady_clock::now();
+      EXPECT_EQ( 0, mgr.compare(nq, q_body, nq3, r_body) );
+      RecordProperty("old_div" + suffix, usec(t5 - t4));
+    }
+
+    mgr.delete_body(q0_body, n / 5);
+    mgr.delete_body(f_body, nq0 * nd + n / 5);
+    mgr.delete_body(q_body, nf);
+    mgr.delete_body(r_body, nf);
+  }
+  mgr.delete_body(d_body, 4);
+}
+
+TEST(MgrTest, op_cache1)
+{
+  // キャッシュが無効の時は統計情報は全て0
+  AlgMgr mgr(10);
+  EXPECT_FALSE( mgr.op_cache_enabled() );
+  auto stats0 = mgr.op_cache_stats();
+  EXPECT_EQ( 0, stats0.hit_num );
+  EXPECT_EQ( 0, stats0.miss_num );
+  EXPECT_EQ( 0, stats0.entry_num );
+  EXPECT_EQ( 0, stats0.limit_words );
+
+  AlgCover f{mgr, "a b + a c + d b + d c + e"};
+  AlgCover g{mgr, "a + d"};
+  AlgCover h{mgr, "b + c"};
+  auto ref_prod = g * h;
+  auto ref_quo = f / g;
+
+  mgr.enable_op_cache();
+  EXPECT_TRUE( mgr.op_cache_enabled() );
+
+  // 1回目はミス，2回目はヒット
+  auto prod1 = g * h;
+  auto stats1 = mgr.op_cache_stats();
+  EXPECT_EQ( 0, stats1.hit_num );
+  EXPECT_EQ( 1, stats1.miss_num );
+  EXPECT_EQ( 1, stats1.entry_num );
+  auto prod2 = g * h;
+  auto stats2 = mgr.op_cache_stats();
+  EXPECT_EQ( 1, stats2.hit_num );
+  EXPECT_EQ( 1, stats2.miss_num );
+  EXPECT_EQ( ref_prod, prod1 );
+  EXPECT_EQ( ref_prod, prod2 );
+
+  auto quo1 = f / g;
+  auto quo2 = f / g;
+  auto stats3 = mgr.op_cache_stats();
+  EXPECT_EQ( 2, stats3.hit_num );
+  EXPECT_EQ( 2, stats3.miss_num );
+  EXPECT_EQ( ref_quo, quo1 );
+  EXPECT_EQ( ref_quo, quo2 );
+
+  // 自分自身に書き込む演算もヒットする．
+  auto f1 = g;
+  f1 *= h;
+  EXPECT_EQ( ref_prod, f1 );
+  auto f2 = f;
+  f2 /= g;
+  EXPECT_EQ( ref_quo, f2 );
+  auto stats4 = mgr.op_cache_stats();
+  EXPECT_EQ( 4, stats4.hit_num );
+  EXPECT_EQ( 2, stats4.miss_num );
+  EXPECT_LE( stats4.used_words, stats4.limit_words );
+
+  mgr.disable_op_cache();
+  EXPECT_FALSE( mgr.op_cache_enabled() );
+  EXPECT_EQ( 0, mgr.op_cache_stats().hit_num );
+}
+
+TEST(MgrTest, op_cache2)
+{
+  // 剰余付きの除算は商だけの除算と区別される．
+  AlgMgr mgr(100);
+  AlgLiteral x0(0, false);
+  AlgLiteral x1(1, false);
+  AlgLiteral x2(2, false);
+  AlgLiteral x70n(70, true);
+  vector<AlgLiteral> f_list{x0, x1, AlgLiteralUndef, x0, x70n, AlgLiteralUndef, x2};
+  vector<AlgLiteral> d_list{x0};
+  ymuint64* f_body = mgr.new_body(3);
+  mgr.set_literal(f_body, 0, f_list);
+  SizeType nf = mgr.sort(3, f_body);
+  ymuint64* d_body = mgr.new_body(1);
+  mgr.set_literal(d_body, 0, d_list);
+  ymuint64* q_body = mgr.new_body(nf);
+  ymuint64* r_body = mgr.new_body(nf);
+
+  mgr.enable_op_cache();
+  SizeType rem_nc;
+  SizeType nq1 = mgr.division(q_body, r_body, rem_nc, nf, f_body, 1, d_body);
+  EXPECT_EQ( 2, nq1 );
+  EXPECT_EQ( 1, rem_nc );
+  SizeType nq2 = mgr.division(q_body, nf, f_body, 1, d_body);
+  EXPECT_EQ( 2, nq2 );
+  EXPECT_EQ( 0, mgr.op_cache_stats().hit_num );
+  EXPECT_EQ( 2, mgr.op_cache_stats().miss_num );
+
+  // 剰余を被除数の領域に書き込む場合でも正しい結果がヒットする．
+  ymuint64* f2_body = mgr.new_body(nf);
+  mgr.copy(nf, f2_body, 0, f_body, 0);
+  SizeType rem_nc2;
+  SizeType nq3 = mgr.division(q_body, f2_body, rem_nc2, nf, f2_body, 1, d_body);
+  EXPECT_EQ( 2, nq3 );
+  EXPECT_EQ( 1, rem_nc2 );
+  EXPECT_EQ( 0, mgr.compare(rem_nc2, f2_body, rem_nc, r_body) );
+  EXPECT_EQ( 1, mgr.op_cache_stats().hit_num );
+
+  mgr.delete_body(f_body, 3);
+  mgr.delete_body(d_body, 1);
+  mgr.delete_body(q_body, nf);
+  mgr.delete_body(r_body, nf);
+  mgr.delete_body(f2_body, nf);
+}
+
+TEST(MgrTest, op_cache2_divisor_alias)
+{
+  // 結果を除数の領域に書き込む場合でも元の除数をキーとして登録する．
+  AlgMgr mgr(10);
+  AlgLiteral x0(0, false);
+  AlgLiteral x1(1, false);
+  AlgLiteral x2(2, false);
+  AlgLiteral x3(3, false);
+  vector<AlgLiteral> f_list{x0, x1, AlgLiteralUndef, x0, x2, AlgLiteralUndef, x3};
+  vector<AlgLiteral> d_list{x0};
+  ymuint64* f_body = mgr.new_body(3);
+  mgr.set_literal(f_body, 0, f_list);
+  SizeType nf = mgr.sort(3, f_body);
+  ymuint64* d_body = mgr.new_body(1);
+  mgr.set_literal(d_body, 0, d_list);
+  ymuint64* q_body = mgr.new_body(nf);
+  ymuint64* r_body = mgr.new_body(nf);
+
+  mgr.enable_op_cache();
+
+  // 剰余を除数の領域に書き込む．
+  ymuint64* d2_body = mgr.new_body(nf);
+  mgr.copy(1, d2_body, 0, d_body, 0);
+  SizeType rem_nc1;
+  SizeType nq1 = mgr.division(q_body, d2_body, rem_nc1, nf, f_body, 1, d2_body);
+  EXPECT_EQ( 2, nq1 );
+  EXPECT_EQ( 1, rem_nc1 );
+
+  // 同じ被演算子の演算はヒットする．
+  SizeType rem_nc2;
+  SizeType nq2 = mgr.division(q_body, r_body, rem_nc2, nf, f_body, 1, d_body);
+  EXPECT_EQ( 2, nq2 );
+  EXPECT_EQ( 1, rem_nc2 );
+  EXPECT_EQ( 0, mgr.compare(rem_nc2, r_body, rem_nc1, d2_body) );
+  EXPECT_EQ( 1, mgr.op_cache_stats().hit_num );
+
+  // 商を除数の領域に書き込む．
+  mgr.copy(1, d2_body, 0, d_body, 0);
+  SizeType nq3 = mgr.division(d2_body, nf, f_body, 1, d2_body);
+  EXPECT_EQ( 2, nq3 );
+  SizeType nq4 = mgr.division(q_body, nf, f_body, 1, d_body);
+  EXPECT_EQ( 2, nq4 );
+  EXPECT_EQ( 0, mgr.compare(nq3, d2_body, nq4, q_body) );
+  EXPECT_EQ( 2, mgr.op_cache_stats().hit_num );
+
+  mgr.delete_body(f_body, 3);
+  mgr.delete_body(d_body, 1);
+  mgr.delete_body(q_body, nf);
+  mgr.delete_body(r_body, nf);
+  mgr.delete_body(d2_body, nf);
+}
+
+TEST(MgrTest, op_cache3)
+{
+  // 上限を小さくすると追い出しが起こる．
+  AlgMgr mgr(20);
+  mgr.enable_op_cache(200);
+  AlgCover g{mgr, "a + b"};
+  vector<AlgCover> ref_list;
+  for ( SizeType i = 2; i < 20; ++ i ) {
+    AlgCover h{mgr, vector<AlgLiteral>{AlgLiteral(i, false)}};
+    ref_list.push_back(g * h);
+  }
+  auto stats = mgr.op_cache_stats();
+  EXPECT_EQ( 18, stats.miss_num );
+  EXPECT_LT( 0, stats.evict_num );
+  EXPECT_EQ( 18, stats.entry_num + stats.evict_num );
+  EXPECT_LE( stats.used_words, stats.limit_words );
+  EXPECT_EQ( 200, stats.limit_words );
+
+  // 追い出された後でも結果は正しい．
+  for ( SizeType i = 2; i < 20; ++ i ) {
+    AlgCover h{mgr, vector<AlgLiteral>{AlgLiteral(i, false)}};
+    EXPECT_EQ( ref_list[i - 2], g * h );
+  }
+}
+
 END_NAMESPACE_YM_BFO
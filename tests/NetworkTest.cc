@@ -0,0 +1,160 @@
+
+/// @file NetworkTest.cc
+/// @brief BfoNetwork のテストプログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "gtest/gtest.h"
+#include "ym/BfoNetwork.h"
+#include "ym/AlgMgr.h"
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+TEST(NetworkTest, empty)
+{
+  AlgMgr mgr(4);
+  BfoNetwork network(mgr);
+
+  EXPECT_EQ( &mgr, &network.mgr() );
+  EXPECT_EQ( 0, network.node_num() );
+  EXPECT_EQ( 0, network.logic_num() );
+  EXPECT_EQ( 0, network.literal_num() );
+  vector<SizeType> node_list;
+  EXPECT_TRUE( network.topological_order(node_list) );
+  EXPECT_TRUE( node_list.empty() );
+}
+
+TEST(NetworkTest, build)
+{
+  AlgMgr mgr(vector<string>{"a", "b", "c"});
+  BfoNetwork network(mgr);
+
+  SizeType x = network.new_input("x");
+  SizeType y = network.new_input("y");
+  SizeType z = network.new_input("z");
+  // 後ろのノードから作っておいてファンインは後で設定する．
+  SizeType f = network.new_logic("f");
+  SizeType g = network.new_logic({x, y}, AlgCover(mgr, "a b' + a' b"), "g");
+  network.set_function(f, {g, z}, AlgCover(mgr, "a c + a' c'"));
+  network.add_output(f);
+
+  EXPECT_EQ( 5, network.node_num() );
+  EXPECT_EQ( (vector<SizeType>{x, y, z}), network.input_list() );
+  EXPECT_EQ( vector<SizeType>{f}, network.output_list() );
+  EXPECT_EQ( 2, network.logic_num() );
+  EXPECT_EQ( 4, network.literal_num(g) );
+  EXPECT_EQ( 4, network.literal_num(f) );
+  EXPECT_EQ( 8, network.literal_num() );
+
+  EXPECT_TRUE( network.is_input(x) );
+  EXPECT_FALSE( network.is_logic(x) );
+  EXPECT_TRUE( network.is_logic(g) );
+  EXPECT_EQ( "g", network.name(g) );
+  EXPECT_EQ( (vector<SizeType>{g, z}), network.fanin_list(f) );
+  EXPECT_EQ( vector<SizeType>{f}, network.fanout_list(g) );
+  EXPECT_EQ( vector<SizeType>{g}, network.fanout_list(x) );
+  EXPECT_EQ( AlgCover(mgr, "a c + a' c'"), network.function(f) );
+
+  vector<SizeType> node_list;
+  EXPECT_TRUE( network.topological_order(node_list) );
+  EXPECT_EQ( (vector<SizeType>{g, f}), node_list );
+}
+
+TEST(NetworkTest, set_function)
+{
+  AlgMgr mgr(vector<string>{"a", "b", "c"});
+  BfoNetwork network(mgr);
+
+  SizeType x = network.new_input();
+  SizeType y = network.new_input();
+  SizeType g = network.new_logic({x, y}, AlgCover(mgr, "a b"));
+  EXPECT_EQ( 2, network.literal_num() );
+
+  // 関数を変更するとリテラル数と接続が更新される．
+  network.set_function(g, {y}, AlgCover(mgr, "a'"));
+  EXPECT_EQ( 1, network.literal_num() );
+  EXPECT_TRUE( network.fanout_list(x).empty() );
+  EXPECT_EQ( vector<SizeType>{g}, network.fanout_list(y) );
+}
+
+TEST(NetworkTest, substitute)
+{
+  AlgMgr mgr(vector<string>{"a", "b", "c"});
+  BfoNetwork network(mgr);
+
+  SizeType x = network.new_input();
+  SizeType y = network.new_input();
+  SizeType g1 = network.new_logic({x, y}, AlgCover(mgr, "a b"));
+  SizeType g2 = network.new_logic({x, y}, AlgCover(mgr, "b a"));
+  SizeType f = network.new_logic({g1, y}, AlgCover(mgr, "a + b"));
+  network.add_output(g1);
+  network.add_output(f);
+  EXPECT_EQ( 6, network.literal_num() );
+
+  // g1 を g2 で置き換えて削除する．
+  network.substitute(g1, g2);
+  EXPECT_EQ( (vector<SizeType>{g2, y}), network.fanin_list(f) );
+  EXPECT_EQ( (vector<SizeType>{g2, f}), network.output_list() );
+  EXPECT_TRUE( network.fanout_list(g1).empty() );
+  network.delete_node(g1);
+  EXPECT_FALSE( network.is_valid(g1) );
+  EXPECT_EQ( 2, network.logic_num() );
+  EXPECT_EQ( 4, network.literal_num() );
+  EXPECT_EQ( 1, network.fanout_list(x).size() );
+
+  vector<SizeType> node_list;
+  EXPECT_TRUE( network.topological_order(node_list) );
+  EXPECT_EQ( (vector<SizeType>{g2, f}), node_list );
+}
+
+TEST(NetworkTest, delete_input)
+{
+  AlgMgr mgr(4);
+  BfoNetwork network(mgr);
+
+  SizeType x = network.new_input();
+  SizeType y = network.new_input();
+  SizeType z = network.new_input();
+  network.delete_node(y);
+  EXPECT_EQ( (vector<SizeType>{x, z}), network.input_list() );
+  EXPECT_EQ( 3, network.node_num() );
+}
+
+TEST(NetworkTest, loop)
+{
+  AlgMgr mgr(vector<string>{"a", "b"});
+  BfoNetwork network(mgr);
+
+  SizeType x = network.new_input();
+  SizeType g1 = network.new_logic();
+  SizeType g2 = network.new_logic({g1, x}, AlgCover(mgr, "a b"));
+  network.set_function(g1, {g2}, AlgCover(mgr, "a'"));
+  SizeType g3 = network.new_logic({x}, AlgCover(mgr, "a"));
+
+  vector<SizeType> node_list;
+  EXPECT_FALSE( network.topological_order(node_list) );
+  EXPECT_EQ( vector<SizeType>{g3}, node_list );
+}
+
+TEST(NetworkTest, constant)
+{
+  AlgMgr mgr(4);
+  BfoNetwork network(mgr);
+
+  // ファンインを持たない定数ノード
+  SizeType c0 = network.new_logic();
+  SizeType c1 = network.new_logic({}, AlgCover(mgr, 0));
+  EXPECT_EQ( 0, network.function(c0).cube_num() );
+  EXPECT_EQ( 1, network.function(c1).cube_num() );
+  EXPECT_EQ( 0, network.literal_num() );
+
+  vector<SizeType> node_list;
+  EXPECT_TRUE( network.topological_order(node_list) );
+  EXPECT_EQ( (vector<SizeType>{c0, c1}), node_list );
+}
+
+END_NAMESPACE_YM_BFO
@@ -0,0 +1,222 @@
+
+/// @file PlaTest.cc
+/// @brief AlgPlaReader/AlgPlaWriter のテストプログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "gtest/gtest.h"
+#include "ym/AlgPlaReader.h"
+#include "ym/AlgPlaWriter.h"
+#include "ym/AlgMgr.h"
+#include <sstream>
+#include <fstream>
+#include <chrono>
+#include <cstdio>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+TEST(PlaTest, read1)
+{
+  std::istringstream s{
+    "# comment\n"
+    ".i 3\n"
+    ".o 2\n"
+    ".ilb x y z\n"
+    ".ob f g\n"
+    ".p 3\n"
+    "1-0 10\n"
+    "01- 11\n"
+    "--1 01\n"
+    ".e\n"
+  };
+
+  AlgPlaReader reader;
+  ASSERT_TRUE( reader.read(s) );
+
+  EXPECT_EQ( 3, reader.input_num() );
+  EXPECT_EQ( 2, reader.output_num() );
+  auto& mgr = reader.mgr();
+  EXPECT_EQ( 3, mgr.variable_num() );
+  EXPECT_EQ( "x", mgr.varname(0) );
+  EXPECT_EQ( "z", mgr.varname(2) );
+  EXPECT_EQ( (vector<string>{"f", "g"}), reader.output_name_list() );
+
+  auto& cover_list = reader.cover_list();
+  ASSERT_EQ( 2, cover_list.size() );
+  EXPECT_EQ( AlgCover(mgr, "x z' + x' y"), cover_list[0] );
+  EXPECT_EQ( AlgCover(mgr, "x' y + z"), cover_list[1] );
+}
+
+TEST(PlaTest, read2)
+{
+  // .ilb も .p もなく，キューブ中に空白がある．
+  std::istringstream s{
+    ".i 4\n"
+    ".o 1\n"
+    "1 1 - - 1\n"
+    "- - 0 1 1\n"
+    "0000 0\n"
+  };
+
+  AlgPlaReader reader;
+  ASSERT_TRUE( reader.read(s) );
+
+  auto& mgr = reader.mgr();
+  ASSERT_EQ( 1, reader.cover_list().size() );
+  EXPECT_EQ( AlgCover(mgr, "a b + c' d"), reader.cover_list()[0] );
+}
+
+TEST(PlaTest, read_many)
+{
+  // .p より多くのキューブがあっても読み込めることを確かめる．
+  std::ostringstream buf;
+  buf << ".i 40" << endl
+      << ".o 1" << endl
+      << ".p 1" << endl;
+  ymuint64 seed = 1;
+  for ( SizeType i = 0; i < 1000; ++ i ) {
+    for ( SizeType j = 0; j < 40; ++ j ) {
+      seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+      buf << "01--"[(seed >> 33) % 4];
+    }
+    buf << " 1" << endl;
+  }
+  std::istringstream s{buf.str()};
+
+  AlgPlaReader reader;
+  ASSERT_TRUE( reader.read(s) );
+  ASSERT_EQ( 1, reader.cover_list().size() );
+  EXPECT_EQ( 1000, reader.cover_list()[0].cube_num() );
+}
+
+TEST(PlaTest, throughput)
+{
+  // 100入力4出力で約 16MB の PLA ファイルの読み書きの速度(MB/s)を測る．
+  const SizeType ni = 100;
+  const SizeType no = 4;
+  const SizeType np = 150000;
+  string filename = ::testing::TempDir() + "bfo_pla_throughput.pla";
+  {
+    std::ofstream ofs{filename};
+    ASSERT_TRUE( ofs );
+    ofs << ".i " << ni << "\n"
+	<< ".o " << no << "\n"
+	<< ".p " << np << "\n";
+    ymuint64 seed = 1;
+    string line(ni + no + 2, ' ');
+    line[ni + no + 1] = '\n';
+    for ( SizeType i = 0; i < np; ++ i ) {
+      for ( SizeType j = 0; j < ni; ++ j ) {
+	seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+	line[j] = "01------"[(seed >> 33) % 8];
+      }
+      for ( SizeType j = 0; j < no; ++ j ) {
+	line[ni + 1 + j] = "01"[(i + j) % 2];
+      }
+      ofs << line;
+    }
+    ofs << ".e\n";
+  }
+  std::ifstream ifs{filename, std::ios::binary | std::ios::ate};
+  double mb = static_cast<double>(ifs.tellg()) / (1024.0 * 1024.0);
+  ifs.close();
+
+  auto sec = [](auto d) {
+    return std::chrono::duration<double>(d).count();
+  };
+
+  AlgPlaReader reader;
+  auto t0 = std::chrono::steady_clock::now();
+  ASSERT_TRUE( reader.read(filename) ) << reader.error_message();
+  auto t1 = std::chrono::steady_clock::now();
+  ASSERT_EQ( no, reader.cover_list().size() );
+  for ( auto& cover: reader.cover_list() ) {
+    EXPECT_LE( cover.cube_num(), np / 2 );
+    EXPECT_LT( 0, cover.cube_num() );
+  }
+
+  AlgPlaWriter writer;
+  auto t2 = std::chrono::steady_clock::now();
+  ASSERT_TRUE( writer.write(filename, reader.cover_list()) );
+  auto t3 = std::chrono::steady_clock::now();
+  std::remove(filename.c_str());
+
+  RecordProperty("file_kb", static_cast<int>(mb * 1024));
+  RecordProperty("read_mb_per_sec", static_cast<int>(mb / sec(t1 - t0)));
+  RecordProperty("write_msec", static_cast<int>(sec(t3 - t2) * 1000));
+}
+
+TEST(PlaTest, error)
+{
+  {
+    std::istringstream s{".o 1\n1 1\n"};
+    AlgPlaReader reader;
+    EXPECT_FALSE( reader.read(s) );
+    EXPECT_EQ( "line 2: .i is missing", reader.error_message() );
+  }
+  {
+    std::istringstream s{".i 2\n.o 1\n1x 1\n"};
+    AlgPlaReader reader;
+    EXPECT_FALSE( reader.read(s) );
+    EXPECT_EQ( "line 3: illegal character 'x' in input part",
+	       reader.error_message() );
+  }
+  {
+    std::istringstream s{".i 2\n.o 2\n11 1\n"};
+    AlgPlaReader reader;
+    EXPECT_FALSE( reader.read(s) );
+    EXPECT_EQ( "line 3: too few outputs", reader.error_message() );
+  }
+  {
+    std::istringstream s{".i 2\n.o 1\n.type fr\n11 1\n"};
+    AlgPlaReader reader;
+    EXPECT_FALSE( reader.read(s) );
+    EXPECT_EQ( "line 3: unsupported .type", reader.error_message() );
+  }
+  for ( auto cmd: {".i 100", ".o 3", ".ilb a b"} ) {
+    // 最初のキューブの後で入出力数は変更できない．
+    std::istringstream s{string{".i 2\n.o 1\n10 1\n"} + cmd + "\n01 111\n"};
+    AlgPlaReader reader;
+    EXPECT_FALSE( reader.read(s) );
+    EXPECT_EQ( "line 4: .i/.o/.ilb after the first cube",
+	       reader.error_message() );
+  }
+}
+
+TEST(PlaTest, write)
+{
+  AlgMgr mgr(vector<string>{"x", "y", "z"});
+  vector<AlgCover> cover_list{
+    AlgCover(mgr, "x z' + x' y"),
+    AlgCover(mgr, "z")
+  };
+
+  std::ostringstream buf;
+  AlgPlaWriter writer{vector<string>{"f", "g"}};
+  writer.write(buf, cover_list);
+
+  EXPECT_EQ( ".i 3\n"
+	     ".o 2\n"
+	     ".ilb x y z\n"
+	     ".ob f g\n"
+	     ".p 3\n"
+	     "1-0 10\n"
+	     "01- 10\n"
+	     "--1 01\n"
+	     ".e\n", buf.str() );
+
+  // 読み戻す．
+  std::istringstream s{buf.str()};
+  AlgPlaReader reader;
+  ASSERT_TRUE( reader.read(s) );
+  auto& mgr2 = reader.mgr();
+  ASSERT_EQ( 2, reader.cover_list().size() );
+  EXPECT_EQ( AlgCover(mgr2, "x z' + x' y"), reader.cover_list()[0] );
+  EXPECT_EQ( AlgCover(mgr2, "z"), reader.cover_list()[1] );
+}
+
+END_NAMESPACE_YM_BFO
@@ -0,0 +1,182 @@
+
+/// @file ThreadTest.cc
+/// @brief 複数スレッドから AlgMgr を使うテスト
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2022 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "gtest/gtest.h"
+#include "ym/AlgCover.h"
+#include "ym/AlgKernelGen.h"
+#include "ym/AlgMgr.h"
+#include <thread>
+
+
+BEGIN_NAMESPACE_YM_BFO
+
+class ThreadTest :
+  public ::testing::Test
+{
+public:
+
+  /// @brief コンストラクタ
+  ThreadTest() : mMgr(70) { }
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief マネージャを返す．
+  AlgMgr&
+  mgr() { return mMgr; }
+
+  /// @brief 疑似乱数でカバーを作る．
+  AlgCover
+  random_cover(
+    SizeType cube_num,
+    ymuint64 seed
+  )
+  {
+    vector<AlgLiteral> lit_list;
+    for ( SizeType i = 0; i < cube_num; ++ i ) {
+      if ( i > 0 ) {
+	lit_list.push_back(AlgLiteralUndef);
+      }
+      for ( int var = 0; var < 70; ++ var ) {
+	seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+	ymuint r = (seed >> 33) % 16;
+	if ( r == 0 ) {
+	  lit_list.push_back(AlgLiteral(var, false));
+	}
+	else if ( r == 1 ) {
+	  lit_list.push_back(AlgLiteral(var, true));
+	}
+      }
+    }
+    return AlgCover(mgr(), lit_list);
+  }
+
+  /// @brief 一連の演算を行う．
+  vector<AlgCover>
+  calc(
+    SizeType id
+  )
+  {
+    AlgCover a = random_cover(40 + id % 7, id * 3 + 1);
+    AlgCover b = random_cover(5 + id % 3, id * 3 + 2);
+    AlgCover c = random_cover(300 + id % 11, id * 3 + 3);
+    vector<AlgCover> ans;
+    ans.push_back(a + b);
+    ans.push_back(a * b);
+    ans.push_back(c - a);
+    AlgCover d = a * b + c;
+    ans.push_back(d / b);
+    auto p = d.div_rem(b);
+    ans.push_back(p.first);
+    ans.push_back(p.second);
+    ans.push_back(AlgCover(mgr(), vector<AlgCube>{d.common_cube()}));
+    return ans;
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // マネージャ
+  AlgMgr mMgr;
+
+};
+
+
+TEST_F(ThreadTest, algebra1)
+{
+  const SizeType thread_num = 8;
+  const SizeType loop_num = 20;
+
+  // 期待値を1スレッドで求めておく．
+  vector<vector<AlgCover>> exp_list;
+  for ( SizeType id = 0; id < thread_num * loop_num; ++ id ) {
+    exp_list.push_back(calc(id));
+  }
+
+  vector<std::thread> th_list;
+  vector<SizeType> error_num(thread_num, 0);
+  for ( SizeType t = 0; t < thread_num; ++ t ) {
+    th_list.push_back(std::thread{[&, t]() {
+      for ( SizeType k = 0; k < loop_num; ++ k ) {
+	SizeType id = k * thread_num + t;
+	auto ans = calc(id);
+	if ( ans != exp_list[id] ) {
+	  ++ error_num[t];
+	}
+      }
+    }});
+  }
+  for ( auto& th: th_list ) {
+    th.join();
+  }
+  for ( SizeType t = 0; t < thread_num; ++ t ) {
+    EXPECT_EQ( 0, error_num[t] );
+  }
+
+  // すべての領域が返されていることを確かめる．
+  exp_list.clear();
+  EXPECT_EQ( 0, mgr().alloc_stats().used_words );
+}
+
+TEST_F(ThreadTest, workspace1)
+{
+  // 終了したスレッドの作業領域は解放される．
+  SizeType ws_num0 = mgr().workspace_num();
+  for ( SizeType loop = 0; loop < 5; ++ loop ) {
+    vector<std::thread> th_list;
+    for ( SizeType t = 0; t < 4; ++ t ) {
+      th_list.push_back(std::thread{[&, t]() {
+	calc(loop * 4 + t);
+      }});
+    }
+    for ( auto& th: th_list ) {
+      th.join();
+    }
+    EXPECT_EQ( ws_num0, mgr().workspace_num() );
+  }
+
+  // スレッドより先にマネージャが削除されてもよい．
+  std::thread th{[]() {
+    AlgMgr mgr1(10);
+    AlgCover cover1(mgr1, "a b + a c + b d");
+    AlgCover cover2(mgr1, "a + d");
+    AlgCover cover3 = cover1 * cover2;
+    EXPECT_EQ( 1, mgr1.workspace_num() );
+  }};
+  th.join();
+}
+
+TEST_F(ThreadTest, kernel1)
+{
+  // 複数スレッドでカーネルを求めても結果が変わらないことを確かめる．
+  AlgCover cover = random_cover(120, 2022);
+
+  AlgKernelGen kg1;
+  vector<AlgKernelInfo> kernel_list1;
+  kg1.generate(cover, kernel_list1);
+
+  AlgKernelGen kg4(4);
+  vector<AlgKernelInfo> kernel_list4;
+  kg4.generate(cover, kernel_list4);
+
+  ASSERT_EQ( kernel_list1.size(), kernel_list4.size() );
+  for ( SizeType i = 0; i < kernel_list1.size(); ++ i ) {
+    EXPECT_EQ( kernel_list1[i].mKernel, kernel_list4[i].mKernel );
+    EXPECT_EQ( kernel_list1[i].mCoKernel, kernel_list4[i].mCoKernel );
+    EXPECT_EQ( kernel_list1[i].mLevel, kernel_list4[i].mLevel );
+  }
+}
+
+END_NAMESPACE_YM_BFO